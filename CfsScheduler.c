@@ -0,0 +1,284 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: CfsScheduler.c
+Brief: Implementation file for completely fair scheduling code
+Details: Implements the CFS-P policy; READY processes are kept in a
+         red-black tree ordered by virtual runtime, the leftmost one runs
+         next, and its slice is its weighted part of the target latency;
+         every core keeps its own tree and least vruntime, and the
+         per-PID statistics are kept once for all cores
+Version: 1.0
+         17 October 2026
+         Initial development of CfsScheduler code
+Note: The weight of a process is its shares from its A(start) line
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "CfsScheduler.h"
+
+/*
+Function name: createCfsPolicy
+Algorithm: Builds the vruntime tree, takes the per-PID accounting from
+           shareWith or builds it here, and sets the CFS hooks of the
+           scheduler; the target latency comes from the config and the
+           config quantum is the least slice given
+Precondition: Given scheduler, simulator config, number of processes, and
+              CFS scheduler of another core, or NULL
+Postcondition: Scheduler runs CFS-P with no READY process
+Exceptions: None
+Note: None
+*/
+void createCfsPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith )
+{
+    CfsPolicy *policy = (CfsPolicy *)malloc( sizeof( CfsPolicy ) );
+    CfsShare *share;
+    int pid;
+
+    policy->ready = createPcbTree();
+    policy->latencyCycles = configDataPtr->cfsLatencyCycles;
+    policy->minGranularity = configDataPtr->quantumCycles;
+    policy->readyWeight = 0;
+    policy->minVruntime = 0;
+
+    if( policy->minGranularity < 1 )
+    {
+        policy->minGranularity = 1;
+    }
+
+    if( shareWith != NULL )
+    {
+        share = (CfsShare *)shareWith->sharedData;
+    }
+    else
+    {
+        share = (CfsShare *)malloc( sizeof( CfsShare ) );
+        pthread_mutex_init( &share->shareLock, NULL );
+        share->pcbCount = pcbCount;
+        share->weights = (int *)malloc( pcbCount * sizeof( int ) );
+        share->cyclesRun = (long *)malloc( pcbCount * sizeof( long ) );
+        share->dispatchCount = 0;
+        share->sliceTotal = 0;
+
+        for( pid = 0; pid < pcbCount; pid++ )
+        {
+            share->weights[ pid ] = 0;
+            share->cyclesRun[ pid ] = 0;
+        }
+
+        scheduler->ownsShared = True;
+    }
+
+    policy->share = share;
+
+    scheduler->policyData = policy;
+    scheduler->sharedData = share;
+    scheduler->preemptive = True;
+    scheduler->enqueue = cfsEnqueue;
+    scheduler->onWake = cfsEnqueue;
+    scheduler->pickNext = cfsPickNext;
+    scheduler->quantum = cfsQuantum;
+    scheduler->onTick = cfsTick;
+    scheduler->onMigrate = cfsMigrate;
+    scheduler->report = cfsReport;
+    scheduler->clearPolicy = clearCfsPolicy;
+}
+
+/*
+Function name: cfsEnqueue
+Algorithm: Raises the vruntime of the pcb to the least vruntime of the
+           runnable processes if it is behind, then inserts it in the tree
+Precondition: Given CFS scheduler and a READY pcb not in the tree
+Postcondition: Pcb is in the tree at its place by vruntime
+Exceptions: None
+Note: O(log n); a process waking from I/O gets no credit for the time it
+      was blocked, so it cannot hold the CPU to catch up
+*/
+void cfsEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+
+    if( pcb->vruntime < policy->minVruntime )
+    {
+        pcb->vruntime = policy->minVruntime;
+    }
+
+    policy->share->weights[ pcb->PID ] = getPcbShares( pcb );
+    policy->readyWeight += getPcbShares( pcb );
+    insertPcbTree( policy->ready, pcb );
+}
+
+/*
+Function name: cfsPickNext
+Algorithm: Removes the leftmost pcb of the tree and notes the least
+           vruntime of this core as its base
+Precondition: Given CFS scheduler
+Postcondition: Returns pcb with the least vruntime, or NULL if none is READY
+Exceptions: None
+Note: O(log n); the base lets another core that steals the pcb keep its
+      lead or lag over the others rather than its raw vruntime
+*/
+PcbType *cfsPickNext( Scheduler *scheduler )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+    PcbType *pcb = firstPcbTree( policy->ready );
+
+    if( pcb != NULL )
+    {
+        removePcbTree( policy->ready, pcb );
+        policy->readyWeight -= getPcbShares( pcb );
+        pcb->vruntimeBase = policy->minVruntime;
+
+        pthread_mutex_lock( &policy->share->shareLock );
+        policy->share->dispatchCount++;
+        pthread_mutex_unlock( &policy->share->shareLock );
+    }
+
+    return pcb;
+}
+
+/*
+Function name: cfsQuantum
+Algorithm: Gives the pcb its weight's part of the target latency, shared
+           with every READY process, but no less than the least slice
+Precondition: Given CFS scheduler and the pcb being dispatched
+Postcondition: Returns number of cycles the pcb may run before preemption
+Exceptions: None
+Note: None
+*/
+int cfsQuantum( Scheduler *scheduler, PcbType *pcb )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+    long weight = getPcbShares( pcb );
+    int slice;
+
+    slice = (int)( policy->latencyCycles * weight
+                                        / ( policy->readyWeight + weight ) );
+
+    if( slice < policy->minGranularity )
+    {
+        slice = policy->minGranularity;
+    }
+
+    pthread_mutex_lock( &policy->share->shareLock );
+    policy->share->sliceTotal += slice;
+    pthread_mutex_unlock( &policy->share->shareLock );
+
+    return slice;
+}
+
+/*
+Function name: cfsTick
+Algorithm: Advances the vruntime of the pcb by the cycles run scaled
+           inversely to its weight, then moves the least vruntime up to the
+           lesser of the running and leftmost READY vruntimes
+Precondition: Given CFS scheduler, running pcb, and cycles it just ran
+Postcondition: Vruntime accounting is brought up to date
+Exceptions: None
+Note: The least vruntime never moves back
+*/
+void cfsTick( Scheduler *scheduler, PcbType *pcb, int cycles )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+    PcbType *leftmost = firstPcbTree( policy->ready );
+    long floor;
+
+    pcb->vruntime += CFS_VRUNTIME_SCALE * cycles / getPcbShares( pcb );
+    policy->share->cyclesRun[ pcb->PID ] += cycles;
+
+    floor = pcb->vruntime;
+
+    if( leftmost != NULL && leftmost->vruntime < floor )
+    {
+        floor = leftmost->vruntime;
+    }
+
+    if( floor > policy->minVruntime )
+    {
+        policy->minVruntime = floor;
+    }
+}
+
+/*
+Function name: cfsMigrate
+Algorithm: Moves the vruntime of a pcb stolen from another core from that
+           core's least vruntime to the same distance above this core's
+Precondition: Given CFS scheduler of the thief and a pcb just picked by
+              another core's CFS scheduler
+Postcondition: Pcb vruntime is measured against this core
+Exceptions: None
+Note: Each core's least vruntime advances with its own load, so a raw
+      vruntime would starve the pcb on a core that is behind, or let it
+      run ahead on one that is further on
+*/
+void cfsMigrate( Scheduler *scheduler, PcbType *pcb )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+
+    pcb->vruntime += policy->minVruntime - pcb->vruntimeBase;
+    pcb->vruntimeBase = policy->minVruntime;
+}
+
+/*
+Function name: cfsReport
+Algorithm: Logs the weight and cycles run of every process this policy
+           scheduled, then the number of dispatches and the average slice
+Precondition: Given CFS scheduler, config, and output log
+Postcondition: CFS statistics are displayed and/or stored in the log
+Exceptions: None
+Note: The statistics cover every core
+*/
+void cfsReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog )
+{
+    CfsShare *share = ( (CfsPolicy *)scheduler->policyData )->share;
+    char displayString[ MAX_STR_LEN ];
+    int pid;
+
+    for( pid = 0; pid < share->pcbCount; pid++ )
+    {
+        if( share->weights[ pid ] > 0 )
+        {
+            sprintf( displayString,
+                "OS: Process %d, weight %d, %ld cycles run\n",
+                pid, share->weights[ pid ], share->cyclesRun[ pid ] );
+            outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+        }
+    }
+
+    sprintf( displayString,
+        "OS: CFS %d dispatches, %.1f cycle average slice\n",
+        share->dispatchCount, share->dispatchCount == 0 ? 0.0 :
+                (double)share->sliceTotal / share->dispatchCount );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+}
+
+/*
+Function name: clearCfsPolicy
+Algorithm: Frees the tree, the per-PID accounting if this scheduler
+           built it, and the policy
+Precondition: Given CFS scheduler
+Postcondition: Policy memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearCfsPolicy( Scheduler *scheduler )
+{
+    CfsPolicy *policy = (CfsPolicy *)scheduler->policyData;
+
+    policy->ready = clearPcbTree( policy->ready );
+
+    if( scheduler->ownsShared == True )
+    {
+        pthread_mutex_destroy( &policy->share->shareLock );
+        free( policy->share->weights );
+        free( policy->share->cyclesRun );
+        free( policy->share );
+    }
+
+    free( policy );
+    scheduler->policyData = NULL;
+    scheduler->sharedData = NULL;
+}
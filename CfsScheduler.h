@@ -0,0 +1,61 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: CfsScheduler.h
+Brief: Header file for completely fair scheduling code
+Details: Specifies functions, constants, and other information
+         related to completely fair scheduling code
+Version: 1.0
+         17 October 2026
+         Initial development of CfsScheduler code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef CFS_SCHEDULER_H
+#define CFS_SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "Scheduler.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define CFS_VRUNTIME_SCALE ( 1L << 20 )
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct CfsShare
+{
+    pthread_mutex_t shareLock;
+    int pcbCount;
+    int *weights;
+    long *cyclesRun;
+    int dispatchCount;
+    long sliceTotal;
+} CfsShare;
+
+typedef struct CfsPolicy
+{
+    PcbTree *ready;
+    int latencyCycles;
+    int minGranularity;
+    long readyWeight;
+    long minVruntime;
+    CfsShare *share;
+} CfsPolicy;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void createCfsPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith );
+void cfsEnqueue( Scheduler *scheduler, PcbType *pcb );
+PcbType *cfsPickNext( Scheduler *scheduler );
+int cfsQuantum( Scheduler *scheduler, PcbType *pcb );
+void cfsTick( Scheduler *scheduler, PcbType *pcb, int cycles );
+void cfsMigrate( Scheduler *scheduler, PcbType *pcb );
+void cfsReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog );
+void clearCfsPolicy( Scheduler *scheduler );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // CFS_SCHEDULER_H
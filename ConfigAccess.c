@@ -22,7 +22,9 @@ Precondition: For correct operation, file is available, is formatted correctly,
               the configuration lines are not required to be
               in a specfic order
 Postcondition: In correct operation,
-               returns pointer to correct configuration data structure
+               returns pointer to correct configuration data structure;
+               optional configuration lines that are not present keep
+               their default values
 Exceptions: Correct and appropriately (without program failure)
             responds to and reports file access failure,
             incorrectly formatted lead or end descriptors,
@@ -39,7 +41,8 @@ int getConfigData( char *fileName, ConfigDataType **configData )
     ConfigDataType *tempData;
     FILE *fileAccessPtr;
     char dataBuffer[ MAX_STR_LEN ];
-    int intData, dataLineCode;
+    int intData, dataLineCode, accessResult;
+    long filePosition;
     double doubleData;
     *configData = NULL;
 
@@ -61,11 +64,25 @@ int getConfigData( char *fileName, ConfigDataType **configData )
     }
 
     tempData = (ConfigDataType *) malloc( sizeof( ConfigDataType ) );
+    setConfigDefaults( tempData );
 
-    while( lineCtr < NUM_DATA_LINES )
+    while( True )
     {
-        if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
-            dataBuffer, IGNORE_LEADING_WS ) != NO_ERR )
+        filePosition = ftell( fileAccessPtr );
+        accessResult = getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
+                                            dataBuffer, IGNORE_LEADING_WS );
+
+        // once all required lines are found, anything that is not an
+        // optional line is left for the end descriptor check
+        if( lineCtr >= NUM_DATA_LINES
+            && ( accessResult != NO_ERR
+              || getDataLineCode( dataBuffer ) == CFG_CORRUPT_PROMPT_ERR ) )
+        {
+            fseek( fileAccessPtr, filePosition, SEEK_SET );
+            break;
+        }
+
+        if( accessResult != NO_ERR )
         {
             free( tempData );
             fclose( fileAccessPtr );
@@ -84,7 +101,12 @@ int getConfigData( char *fileName, ConfigDataType **configData )
             else if( dataLineCode == CFG_MD_FILE_NAME_CODE
                   || dataLineCode == CFG_LOG_FILE_NAME_CODE
                   || dataLineCode == CFG_CPU_SCHED_CODE
-                  || dataLineCode == CFG_LOG_TO_CODE )
+                  || dataLineCode == CFG_LOG_TO_CODE
+                  || dataLineCode == CFG_CLOCK_MODE_CODE
+                  || dataLineCode == CFG_MLFQ_QUANTA_CODE
+                  || dataLineCode == CFG_INTERRUPT_QUEUE_CODE
+                  || dataLineCode == CFG_PAGING_CODE
+                  || dataLineCode == CFG_PAGE_REPLACEMENT_CODE )
             {
                 fscanf( fileAccessPtr, "%s", dataBuffer );
             }
@@ -134,6 +156,82 @@ int getConfigData( char *fileName, ConfigDataType **configData )
                     case CFG_LOG_FILE_NAME_CODE:
                         copyString( tempData->logToFileName, dataBuffer );
                         break;
+
+                    case CFG_CLOCK_MODE_CODE:
+                        tempData->clockModeCode =
+                                            getClockModeCode( dataBuffer );
+                        break;
+
+                    case CFG_CPU_CORES_CODE:
+                        tempData->cpuCores = intData;
+                        break;
+
+                    case CFG_MLFQ_QUANTA_CODE:
+                        tempData->mlfqLevels = getMlfqQuanta( dataBuffer,
+                                                        tempData->mlfqQuanta );
+                        break;
+
+                    case CFG_MLFQ_BOOST_CODE:
+                        tempData->mlfqBoostCycles = intData;
+                        break;
+
+                    case CFG_LOTTERY_SEED_CODE:
+                        tempData->lotterySeed = intData;
+                        break;
+
+                    case CFG_CFS_LATENCY_CODE:
+                        tempData->cfsLatencyCycles = intData;
+                        break;
+
+                    case CFG_SWITCH_COST_CODE:
+                        tempData->switchCost = intData;
+                        break;
+
+                    case CFG_DECISION_COST_CODE:
+                        tempData->decisionCost = intData;
+                        break;
+
+                    case CFG_INTERRUPT_COST_CODE:
+                        tempData->interruptCost = intData;
+                        break;
+
+                    case CFG_INTERRUPT_QUEUE_CODE:
+                        tempData->interruptQueueCode =
+                                        getInterruptQueueCode( dataBuffer );
+                        break;
+
+                    case CFG_PAGING_CODE:
+                        tempData->pagingCode = getPagingCode( dataBuffer );
+                        break;
+
+                    case CFG_PAGE_SIZE_CODE:
+                        tempData->pageSize = intData;
+                        break;
+
+                    case CFG_TLB_ENTRIES_CODE:
+                        tempData->tlbEntries = intData;
+                        break;
+
+                    case CFG_TLB_MISS_COST_CODE:
+                        tempData->tlbMissCost = intData;
+                        break;
+
+                    case CFG_PAGE_WALK_COST_CODE:
+                        tempData->pageWalkCost = intData;
+                        break;
+
+                    case CFG_PAGE_REPLACEMENT_CODE:
+                        tempData->pageReplacementCode =
+                                        getPageReplacementCode( dataBuffer );
+                        break;
+
+                    case CFG_SWAP_TIME_CODE:
+                        tempData->swapTime = intData;
+                        break;
+
+                    case CFG_SWAP_AVAILABLE_CODE:
+                        tempData->swapAvailable = intData;
+                        break;
                 }
             }
 
@@ -152,7 +250,10 @@ int getConfigData( char *fileName, ConfigDataType **configData )
             return CFG_CORRUPT_PROMPT_ERR;
         }
 
-        lineCtr++;
+        if( dataLineCode <= CFG_LOG_FILE_NAME_CODE )
+        {
+            lineCtr++;
+        }
     }
 
     if( getLineTo( fileAccessPtr, MAX_STR_LEN, PERIOD,
@@ -229,6 +330,97 @@ int getDataLineCode( char *dataBuffer )
         return CFG_LOG_FILE_NAME_CODE;
     }
 
+    if( compareString( dataBuffer, "Clock Mode" ) == STR_EQ )
+    {
+        return CFG_CLOCK_MODE_CODE;
+    }
+
+    if( compareString( dataBuffer, "CPU Cores" ) == STR_EQ )
+    {
+        return CFG_CPU_CORES_CODE;
+    }
+
+    if( compareString( dataBuffer, "MLFQ Quanta (cycles)" ) == STR_EQ )
+    {
+        return CFG_MLFQ_QUANTA_CODE;
+    }
+
+    if( compareString( dataBuffer, "MLFQ Boost Period (cycles)" ) == STR_EQ )
+    {
+        return CFG_MLFQ_BOOST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Lottery Seed" ) == STR_EQ )
+    {
+        return CFG_LOTTERY_SEED_CODE;
+    }
+
+    if( compareString( dataBuffer, "CFS Latency (cycles)" ) == STR_EQ )
+    {
+        return CFG_CFS_LATENCY_CODE;
+    }
+
+    if( compareString( dataBuffer, "Context Switch Cost (msec)" ) == STR_EQ )
+    {
+        return CFG_SWITCH_COST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Scheduler Decision Cost (msec)" )
+                                                                    == STR_EQ )
+    {
+        return CFG_DECISION_COST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Interrupt Entry Cost (msec)" ) == STR_EQ )
+    {
+        return CFG_INTERRUPT_COST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Interrupt Queue" ) == STR_EQ )
+    {
+        return CFG_INTERRUPT_QUEUE_CODE;
+    }
+
+    if( compareString( dataBuffer, "Memory Paging" ) == STR_EQ )
+    {
+        return CFG_PAGING_CODE;
+    }
+
+    if( compareString( dataBuffer, "Page Size" ) == STR_EQ )
+    {
+        return CFG_PAGE_SIZE_CODE;
+    }
+
+    if( compareString( dataBuffer, "TLB Entries" ) == STR_EQ )
+    {
+        return CFG_TLB_ENTRIES_CODE;
+    }
+
+    if( compareString( dataBuffer, "TLB Miss Cost (msec)" ) == STR_EQ )
+    {
+        return CFG_TLB_MISS_COST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Page Walk Cost (msec)" ) == STR_EQ )
+    {
+        return CFG_PAGE_WALK_COST_CODE;
+    }
+
+    if( compareString( dataBuffer, "Page Replacement" ) == STR_EQ )
+    {
+        return CFG_PAGE_REPLACEMENT_CODE;
+    }
+
+    if( compareString( dataBuffer, "Swap Time (msec)" ) == STR_EQ )
+    {
+        return CFG_SWAP_TIME_CODE;
+    }
+
+    if( compareString( dataBuffer, "Swap Available (KB)" ) == STR_EQ )
+    {
+        return CFG_SWAP_AVAILABLE_CODE;
+    }
+
     return CFG_CORRUPT_PROMPT_ERR;
 }
 
@@ -271,6 +463,31 @@ ConfigDataCodes getCpuSchedCode( char *codeStr )
         returnVal = CPU_SCHED_RR_P_CODE;
     }
 
+    if( compareString( tempStr, "mlfq-p" ) == STR_EQ )
+    {
+        returnVal = CPU_SCHED_MLFQ_P_CODE;
+    }
+
+    if( compareString( tempStr, "stride-p" ) == STR_EQ )
+    {
+        returnVal = CPU_SCHED_STRIDE_P_CODE;
+    }
+
+    if( compareString( tempStr, "lottery-p" ) == STR_EQ )
+    {
+        returnVal = CPU_SCHED_LOTTERY_P_CODE;
+    }
+
+    if( compareString( tempStr, "edf-p" ) == STR_EQ )
+    {
+        returnVal = CPU_SCHED_EDF_P_CODE;
+    }
+
+    if( compareString( tempStr, "cfs-p" ) == STR_EQ )
+    {
+        returnVal = CPU_SCHED_CFS_P_CODE;
+    }
+
     free( tempStr );
     return returnVal;
 }
@@ -293,6 +510,7 @@ Boolean valueInRange( int lineCode, int intVal,
     Boolean result = True;
     char *tempStr;
     int strLen;
+    int quanta[ MLFQ_MAX_LEVELS ];
 
     switch ( lineCode )
     {
@@ -313,7 +531,12 @@ Boolean valueInRange( int lineCode, int intVal,
              && compareString( tempStr, "sjf-n" ) != STR_EQ
              && compareString( tempStr, "srtf-p" ) != STR_EQ
              && compareString( tempStr, "fcfs-p" ) != STR_EQ
-             && compareString( tempStr, "rr-p" ) != STR_EQ )
+             && compareString( tempStr, "rr-p" ) != STR_EQ
+             && compareString( tempStr, "mlfq-p" ) != STR_EQ
+             && compareString( tempStr, "stride-p" ) != STR_EQ
+             && compareString( tempStr, "lottery-p" ) != STR_EQ
+             && compareString( tempStr, "edf-p" ) != STR_EQ
+             && compareString( tempStr, "cfs-p" ) != STR_EQ )
             {
                 result = False;
             }
@@ -363,6 +586,144 @@ Boolean valueInRange( int lineCode, int intVal,
 
             free( tempStr );
             break;
+
+        case CFG_CLOCK_MODE_CODE:
+            strLen = getStringLength( stringVal );
+            tempStr = (char *) malloc( strLen + 1 );
+            setStrToLowerCase( tempStr, stringVal);
+
+            if( compareString( tempStr, "real" ) != STR_EQ
+             && compareString( tempStr, "virtual" ) != STR_EQ )
+            {
+                result = False;
+            }
+
+            free( tempStr );
+            break;
+
+        case CFG_CPU_CORES_CODE:
+            if( intVal < 1 || intVal > 64 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_MLFQ_QUANTA_CODE:
+            if( getMlfqQuanta( stringVal, quanta ) == 0 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_MLFQ_BOOST_CODE:
+            if( intVal < 0 || intVal > 100000 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_LOTTERY_SEED_CODE:
+            if( intVal < 1 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_CFS_LATENCY_CODE:
+            if( intVal < 1 || intVal > 10000 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_SWITCH_COST_CODE:
+        case CFG_DECISION_COST_CODE:
+        case CFG_INTERRUPT_COST_CODE:
+            if( intVal < 0 || intVal > 1000 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_INTERRUPT_QUEUE_CODE:
+            strLen = getStringLength( stringVal );
+            tempStr = (char *) malloc( strLen + 1 );
+            setStrToLowerCase( tempStr, stringVal );
+
+            if( compareString( tempStr, "heap" ) != STR_EQ
+             && compareString( tempStr, "wheel" ) != STR_EQ )
+            {
+                result = False;
+            }
+
+            free( tempStr );
+            break;
+
+        case CFG_PAGING_CODE:
+            strLen = getStringLength( stringVal );
+            tempStr = (char *) malloc( strLen + 1 );
+            setStrToLowerCase( tempStr, stringVal );
+
+            if( compareString( tempStr, "off" ) != STR_EQ
+             && compareString( tempStr, "on" ) != STR_EQ
+             && compareString( tempStr, "demand" ) != STR_EQ )
+            {
+                result = False;
+            }
+
+            free( tempStr );
+            break;
+
+        case CFG_PAGE_REPLACEMENT_CODE:
+            strLen = getStringLength( stringVal );
+            tempStr = (char *) malloc( strLen + 1 );
+            setStrToLowerCase( tempStr, stringVal );
+
+            if( compareString( tempStr, "fifo" ) != STR_EQ
+             && compareString( tempStr, "lru" ) != STR_EQ
+             && compareString( tempStr, "clock" ) != STR_EQ )
+            {
+                result = False;
+            }
+
+            free( tempStr );
+            break;
+
+        case CFG_SWAP_TIME_CODE:
+            if( intVal < 0 || intVal > 10000 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_SWAP_AVAILABLE_CODE:
+            if( intVal < 0 || intVal > 102400 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_PAGE_SIZE_CODE:
+            if( intVal < 1 || intVal > 1000 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_TLB_ENTRIES_CODE:
+            if( intVal < 1 || intVal > 1024 )
+            {
+                result = False;
+            }
+            break;
+
+        case CFG_TLB_MISS_COST_CODE:
+        case CFG_PAGE_WALK_COST_CODE:
+            if( intVal < 0 || intVal > 1000 )
+            {
+                result = False;
+            }
+            break;
     }
 
     return result;
@@ -401,6 +762,208 @@ ConfigDataCodes getLogToCode( char *logToStr )
     return returnVal;
 }
 
+/*
+Function name: getClockModeCode
+Algorithm: Converts string data (e.g., "Real", "Virtual")
+           to constant code number to be stored as integer
+Precondition: clockModeStr is a C-Style string with one
+              of the specified clock modes
+Postcondition: Returns code representing clock mode
+Exceptions: Defaults to real clock code
+Note: None
+*/
+ConfigDataCodes getClockModeCode( char *clockModeStr )
+{
+    // Initialize function/variables
+    int strLen = getStringLength( clockModeStr );
+    char *tempStr = (char *) malloc( strLen + 1 );
+    int returnVal = CLOCK_REAL_CODE;
+
+    setStrToLowerCase( tempStr, clockModeStr );
+
+    if( compareString( tempStr, "virtual" ) == STR_EQ )
+    {
+        returnVal = CLOCK_VIRTUAL_CODE;
+    }
+
+    free( tempStr );
+    return returnVal;
+}
+
+/*
+Function name: getInterruptQueueCode
+Algorithm: Converts string data (e.g., "Heap", "Wheel")
+           to constant code number to be stored as integer
+Precondition: queueStr is a C-Style string with one
+              of the specified interrupt queues
+Postcondition: Returns code representing interrupt queue
+Exceptions: Defaults to heap code
+Note: None
+*/
+ConfigDataCodes getInterruptQueueCode( char *queueStr )
+{
+    // Initialize function/variables
+    int strLen = getStringLength( queueStr );
+    char *tempStr = (char *) malloc( strLen + 1 );
+    int returnVal = INTERRUPT_QUEUE_HEAP_CODE;
+
+    setStrToLowerCase( tempStr, queueStr );
+
+    if( compareString( tempStr, "wheel" ) == STR_EQ )
+    {
+        returnVal = INTERRUPT_QUEUE_WHEEL_CODE;
+    }
+
+    free( tempStr );
+    return returnVal;
+}
+
+/*
+Function name: getPageReplacementCode
+Algorithm: Converts string data (e.g., "FIFO", "LRU", "Clock")
+           to constant code number to be stored as integer
+Precondition: replacementStr is a C-Style string with one
+              of the specified page replacement policies
+Postcondition: Returns code representing page replacement policy
+Exceptions: Defaults to FIFO code
+Note: None
+*/
+ConfigDataCodes getPageReplacementCode( char *replacementStr )
+{
+    // Initialize function/variables
+    int strLen = getStringLength( replacementStr );
+    char *tempStr = (char *) malloc( strLen + 1 );
+    int returnVal = REPLACE_FIFO_CODE;
+
+    setStrToLowerCase( tempStr, replacementStr );
+
+    if( compareString( tempStr, "lru" ) == STR_EQ )
+    {
+        returnVal = REPLACE_LRU_CODE;
+    }
+
+    if( compareString( tempStr, "clock" ) == STR_EQ )
+    {
+        returnVal = REPLACE_CLOCK_CODE;
+    }
+
+    free( tempStr );
+    return returnVal;
+}
+
+/*
+Function name: getPagingCode
+Algorithm: Converts string data (e.g., "On", "Off", "Demand")
+           to constant code number to be stored as integer
+Precondition: pagingStr is a C-Style string with one
+              of the specified paging modes
+Postcondition: Returns code representing paging mode
+Exceptions: Defaults to paging off code
+Note: None
+*/
+ConfigDataCodes getPagingCode( char *pagingStr )
+{
+    // Initialize function/variables
+    int strLen = getStringLength( pagingStr );
+    char *tempStr = (char *) malloc( strLen + 1 );
+    int returnVal = PAGING_OFF_CODE;
+
+    setStrToLowerCase( tempStr, pagingStr );
+
+    if( compareString( tempStr, "on" ) == STR_EQ )
+    {
+        returnVal = PAGING_ON_CODE;
+    }
+
+    if( compareString( tempStr, "demand" ) == STR_EQ )
+    {
+        returnVal = PAGING_DEMAND_CODE;
+    }
+
+    free( tempStr );
+    return returnVal;
+}
+
+/*
+Function name: getMlfqQuanta
+Algorithm: Reads a comma separated list of quanta (e.g., "2,4,8"), one for
+           each MLFQ level from the highest priority down
+Precondition: quantaStr is a C-Style string, quanta has room for
+              MLFQ_MAX_LEVELS values
+Postcondition: Returns number of levels read with their quanta stored,
+               or 0 if the list is malformed
+Exceptions: Any quantum outside 1 to 100 cycles, an empty entry, or more
+            than MLFQ_MAX_LEVELS entries makes the whole list malformed
+Note: None
+*/
+int getMlfqQuanta( char *quantaStr, int *quanta )
+{
+    int levels = 0, value = 0, digits = 0, index;
+
+    for( index = 0; index <= getStringLength( quantaStr ); index++ )
+    {
+        if( quantaStr[ index ] >= '0' && quantaStr[ index ] <= '9' )
+        {
+            value = value * 10 + ( quantaStr[ index ] - '0' );
+            digits++;
+
+            if( value > 100 )
+            {
+                return 0;
+            }
+        }
+        else if( quantaStr[ index ] == ',' || quantaStr[ index ] == NULL_CHAR )
+        {
+            if( digits == 0 || value < 1 || levels == MLFQ_MAX_LEVELS )
+            {
+                return 0;
+            }
+
+            quanta[ levels ] = value;
+            levels++;
+            value = 0;
+            digits = 0;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    return levels;
+}
+
+/*
+Function name: setConfigDefaults
+Algorithm: Assigns default values to the optional configuration items
+Precondition: Parameter has pointer to allocated data set
+Postcondition: Optional configuration items hold their default values
+Exceptions: None
+Note: Required configuration items are always overwritten by the file;
+      zero MLFQ levels lets the policy derive its levels from the quantum
+*/
+void setConfigDefaults( ConfigDataType *configData )
+{
+    configData->clockModeCode = CLOCK_REAL_CODE;
+    configData->cpuCores = 1;
+    configData->mlfqLevels = 0;
+    configData->mlfqBoostCycles = 0;
+    configData->lotterySeed = 1;
+    configData->cfsLatencyCycles = 24;
+    configData->switchCost = 0;
+    configData->decisionCost = 0;
+    configData->interruptCost = 0;
+    configData->interruptQueueCode = INTERRUPT_QUEUE_HEAP_CODE;
+    configData->pagingCode = PAGING_OFF_CODE;
+    configData->pageSize = 16;
+    configData->tlbEntries = 16;
+    configData->tlbMissCost = 1;
+    configData->pageWalkCost = 2;
+    configData->pageReplacementCode = REPLACE_FIFO_CODE;
+    configData->swapTime = 20;
+    configData->swapAvailable = 8192;
+}
+
 /*
 Function name: displayConfigData
 Algorithm: Diagnostic function to show config data output
@@ -427,6 +990,28 @@ void displayConfigData( ConfigDataType *configData )
     configCodeToString( configData->logToCode, displayString );
     printf( "Log to selection       : %s\n", displayString );
     printf( "Log file name          : %s\n", configData->logToFileName );
+    configCodeToString( configData->clockModeCode, displayString );
+    printf( "Clock mode             : %s\n", displayString );
+    printf( "CPU cores              : %d\n", configData->cpuCores );
+    printf( "MLFQ levels            : %d\n", configData->mlfqLevels );
+    printf( "MLFQ boost period      : %d\n", configData->mlfqBoostCycles );
+    printf( "Lottery seed           : %d\n", configData->lotterySeed );
+    printf( "CFS latency            : %d\n", configData->cfsLatencyCycles );
+    printf( "Context switch cost    : %d\n", configData->switchCost );
+    printf( "Sched decision cost    : %d\n", configData->decisionCost );
+    printf( "Interrupt entry cost   : %d\n", configData->interruptCost );
+    configCodeToString( configData->interruptQueueCode, displayString );
+    printf( "Interrupt queue        : %s\n", displayString );
+    configCodeToString( configData->pagingCode, displayString );
+    printf( "Memory paging          : %s\n", displayString );
+    printf( "Page size              : %d\n", configData->pageSize );
+    printf( "TLB entries            : %d\n", configData->tlbEntries );
+    printf( "TLB miss cost          : %d\n", configData->tlbMissCost );
+    printf( "Page walk cost         : %d\n", configData->pageWalkCost );
+    configCodeToString( configData->pageReplacementCode, displayString );
+    printf( "Page replacement       : %s\n", displayString );
+    printf( "Swap time              : %d\n", configData->swapTime );
+    printf( "Swap available         : %d\n", configData->swapAvailable );
 }
 
 /*
@@ -442,9 +1027,13 @@ Note: None
 */
 void configCodeToString( int code, char *outString )
 {
-    char displayStrings[ 8 ][ 10 ] = { "SJF-N", "SRTF-P", "FCFS-P",
-                                       "RR-P", "FCFS-N", "Monitor",
-                                       "File", "Both" };
+    char displayStrings[ 23 ][ 10 ] = { "SJF-N", "SRTF-P", "FCFS-P",
+                                        "RR-P", "FCFS-N", "MLFQ-P",
+                                        "STRIDE-P", "LOTTERY-P", "EDF-P",
+                                        "CFS-P", "Monitor", "File", "Both",
+                                        "Real", "Virtual", "Heap", "Wheel",
+                                        "Off", "On", "Demand", "FIFO", "LRU",
+                                        "Clock" };
 
     copyString( outString, displayStrings[ code ] );
 }
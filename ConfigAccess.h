@@ -18,6 +18,9 @@ Note: Code based on 'Introduction to C Programming' tutorial
 // Header Files ///////////////////////////////////////////////////
 #include "StringUtils.h"
 
+// Global Constant Definitions /////////////////////////////////////
+#define MLFQ_MAX_LEVELS 8
+
 // Data Structure Definitions (structs, enums, etc.)///////////////
 
 typedef enum ConfigCodeMessages
@@ -34,7 +37,25 @@ typedef enum ConfigCodeMessages
     CFG_PROC_CYCLES_CODE,
     CFG_IO_CYCLES_CODE,
     CFG_LOG_TO_CODE,
-    CFG_LOG_FILE_NAME_CODE
+    CFG_LOG_FILE_NAME_CODE,
+    CFG_CLOCK_MODE_CODE,
+    CFG_CPU_CORES_CODE,
+    CFG_MLFQ_QUANTA_CODE,
+    CFG_MLFQ_BOOST_CODE,
+    CFG_LOTTERY_SEED_CODE,
+    CFG_CFS_LATENCY_CODE,
+    CFG_SWITCH_COST_CODE,
+    CFG_DECISION_COST_CODE,
+    CFG_INTERRUPT_COST_CODE,
+    CFG_INTERRUPT_QUEUE_CODE,
+    CFG_PAGING_CODE,
+    CFG_PAGE_SIZE_CODE,
+    CFG_TLB_ENTRIES_CODE,
+    CFG_TLB_MISS_COST_CODE,
+    CFG_PAGE_WALK_COST_CODE,
+    CFG_PAGE_REPLACEMENT_CODE,
+    CFG_SWAP_TIME_CODE,
+    CFG_SWAP_AVAILABLE_CODE
 } ConfigCodeMessages;
 
 typedef enum ConfigDataCodes
@@ -44,9 +65,24 @@ typedef enum ConfigDataCodes
     CPU_SCHED_FCFS_P_CODE,
     CPU_SCHED_RR_P_CODE,
     CPU_SCHED_FCFS_N_CODE,
+    CPU_SCHED_MLFQ_P_CODE,
+    CPU_SCHED_STRIDE_P_CODE,
+    CPU_SCHED_LOTTERY_P_CODE,
+    CPU_SCHED_EDF_P_CODE,
+    CPU_SCHED_CFS_P_CODE,
     LOGTO_MONITOR_CODE,
     LOGTO_FILE_CODE,
-    LOGTO_BOTH_CODE
+    LOGTO_BOTH_CODE,
+    CLOCK_REAL_CODE,
+    CLOCK_VIRTUAL_CODE,
+    INTERRUPT_QUEUE_HEAP_CODE,
+    INTERRUPT_QUEUE_WHEEL_CODE,
+    PAGING_OFF_CODE,
+    PAGING_ON_CODE,
+    PAGING_DEMAND_CODE,
+    REPLACE_FIFO_CODE,
+    REPLACE_LRU_CODE,
+    REPLACE_CLOCK_CODE
 } ConfigDataCodes;
 
 typedef struct ConfigDataType
@@ -60,6 +96,25 @@ typedef struct ConfigDataType
     int ioCycleRate;
     int logToCode;
     char logToFileName[ 100 ];
+    int clockModeCode;
+    int cpuCores;
+    int mlfqLevels;
+    int mlfqQuanta[ MLFQ_MAX_LEVELS ];
+    int mlfqBoostCycles;
+    int lotterySeed;
+    int cfsLatencyCycles;
+    int switchCost;
+    int decisionCost;
+    int interruptCost;
+    int interruptQueueCode;
+    int pagingCode;
+    int pageSize;
+    int tlbEntries;
+    int tlbMissCost;
+    int pageWalkCost;
+    int pageReplacementCode;
+    int swapTime;
+    int swapAvailable;
 } ConfigDataType;
 
 // Function Prototypes ///////////////////////////////////////////
@@ -69,6 +124,12 @@ Boolean valueInRange( int lineCode, int intVal,
                                           double doubleVal, char *stringVal );
 ConfigDataCodes getCpuSchedCode( char *codeStr );
 ConfigDataCodes getLogToCode( char *logToStr );
+ConfigDataCodes getClockModeCode( char *clockModeStr );
+ConfigDataCodes getInterruptQueueCode( char *queueStr );
+ConfigDataCodes getPagingCode( char *pagingStr );
+ConfigDataCodes getPageReplacementCode( char *replacementStr );
+int getMlfqQuanta( char *quantaStr, int *quanta );
+void setConfigDefaults( ConfigDataType *configData );
 void displayConfigData( ConfigDataType *configData );
 void configCodeToString( int code, char *outString );
 void displayConfigError( int errCode );
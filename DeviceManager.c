@@ -0,0 +1,425 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: DeviceManager.c
+Brief: Implementation file for simulated device worker code
+Details: Implements one long-lived worker thread per simulated device class,
+         each fed through its own work queue; asynchronous requests are
+         handed back to the simulator through a lock-free completion queue
+Version: 1.0
+         17 October 2026
+         Initial development of DeviceManager code
+Note: Requests are owned by the caller, so submitting an operation does not
+      allocate memory or create a thread; the completion queue has many
+      producers (the workers) and a single consumer (the simulator)
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "DeviceManager.h"
+
+/*
+Function name: startDevices
+Algorithm: Creates the device manager and sets up an empty work queue for
+           each simulated device class
+Precondition: None
+Postcondition: Returns device manager with every worker ready to start
+Exceptions: None
+Note: A worker thread is started by the first request for its device, so
+      devices no op uses, such as the processor when run ops are timed on
+      the engine thread, cost no thread
+*/
+DeviceManager *startDevices( void )
+{
+    DeviceManager *devices;
+    DeviceWorker *worker;
+    pthread_condattr_t monotonicAttr;
+    int deviceClass;
+
+    devices = (DeviceManager *)malloc( sizeof( DeviceManager ) );
+    atomic_init( &devices->completions, NULL );
+    sem_init( &devices->completionsPosted, 0, 0 );
+
+    // timed waits are measured against the same clock as the simulator
+    pthread_condattr_init( &monotonicAttr );
+    pthread_condattr_setclock( &monotonicAttr, CLOCK_MONOTONIC );
+
+    for( deviceClass = 0; deviceClass < DEVICE_CLASS_COUNT; deviceClass++ )
+    {
+        worker = &devices->workers[ deviceClass ];
+        pthread_mutex_init( &worker->lock, NULL );
+        pthread_cond_init( &worker->workReady, &monotonicAttr );
+        pthread_cond_init( &worker->workDone, NULL );
+        worker->head = NULL;
+        worker->started = False;
+        worker->shutdown = False;
+        worker->devices = devices;
+    }
+
+    pthread_condattr_destroy( &monotonicAttr );
+    return devices;
+}
+
+/*
+Function name: stopDevices
+Algorithm: Signals every worker to finish its queued work and exit,
+           joins the worker threads that were started, and returns memory
+           to OS
+Precondition: Given device manager, with or without data
+Postcondition: All workers have exited, return pointer is set to null
+Exceptions: None
+Note: None
+*/
+DeviceManager *stopDevices( DeviceManager *devices )
+{
+    DeviceWorker *worker;
+    int deviceClass;
+
+    if( devices == NULL )
+    {
+        return NULL;
+    }
+
+    for( deviceClass = 0; deviceClass < DEVICE_CLASS_COUNT; deviceClass++ )
+    {
+        worker = &devices->workers[ deviceClass ];
+        pthread_mutex_lock( &worker->lock );
+        worker->shutdown = True;
+        pthread_cond_signal( &worker->workReady );
+        pthread_mutex_unlock( &worker->lock );
+    }
+
+    for( deviceClass = 0; deviceClass < DEVICE_CLASS_COUNT; deviceClass++ )
+    {
+        worker = &devices->workers[ deviceClass ];
+
+        if( worker->started == True )
+        {
+            pthread_join( worker->threadID, NULL );
+        }
+
+        pthread_mutex_destroy( &worker->lock );
+        pthread_cond_destroy( &worker->workReady );
+        pthread_cond_destroy( &worker->workDone );
+    }
+
+    sem_destroy( &devices->completionsPosted );
+    free( devices );
+    return NULL;
+}
+
+/*
+Function name: getDeviceClass
+Algorithm: Maps a P, I, or O op code to the device class that serves it
+Precondition: Given P, I, or O op code
+Postcondition: Returns device class for the op code
+Exceptions: None
+Note: Unknown device names are served by the processor
+*/
+DeviceClass getDeviceClass( OpCodeType *opCode )
+{
+    if( opCode->opLtr == 'I' || opCode->opLtr == 'O' )
+    {
+        if( compareString( opCode->opName, "hard drive" ) == STR_EQ )
+        {
+            return HARD_DRIVE_DEVICE;
+        }
+
+        if( compareString( opCode->opName, "keyboard" ) == STR_EQ )
+        {
+            return KEYBOARD_DEVICE;
+        }
+
+        if( compareString( opCode->opName, "monitor" ) == STR_EQ )
+        {
+            return MONITOR_DEVICE;
+        }
+
+        if( compareString( opCode->opName, "printer" ) == STR_EQ )
+        {
+            return PRINTER_DEVICE;
+        }
+    }
+
+    return PROCESSOR_DEVICE;
+}
+
+/*
+Function name: submitDeviceOp
+Algorithm: Inserts a request into the work queue of the given device class,
+           ordered by ending time so the earliest request is served first,
+           and wakes its worker, starting the worker thread on the first
+           request
+Precondition: Given device manager, device class, and a request with its
+              PID and time filled in; asynchronous requests also have their
+              ending time and op names filled in
+Postcondition: Request is queued and marked incomplete
+Exceptions: None
+Note: Synchronous requests have no ending time and are served in order of
+      submission; request memory must stay valid until the request completes
+*/
+void submitDeviceOp( DeviceManager *devices, DeviceClass deviceClass,
+                                                    DeviceRequest *request )
+{
+    DeviceWorker *worker = &devices->workers[ deviceClass ];
+    DeviceRequest **link;
+
+    if( request->isAsync == False )
+    {
+        request->endingTime = 0;
+    }
+    request->complete = False;
+
+    pthread_mutex_lock( &worker->lock );
+
+    link = &worker->head;
+    while( *link != NULL && ( *link )->endingTime <= request->endingTime )
+    {
+        link = &( *link )->next;
+    }
+    request->next = *link;
+    *link = request;
+
+    if( worker->started == False )
+    {
+        worker->started = True;
+        pthread_create( &worker->threadID, NULL, runDeviceWorker,
+                                                            (void *)worker );
+    }
+
+    pthread_cond_signal( &worker->workReady );
+    pthread_mutex_unlock( &worker->lock );
+}
+
+/*
+Function name: awaitDeviceOp
+Algorithm: Waits on the device worker until the given request is complete
+Precondition: Given device manager, device class, and a submitted
+              synchronous request
+Postcondition: Request has completed and may be reused
+Exceptions: None
+Note: None
+*/
+void awaitDeviceOp( DeviceManager *devices, DeviceClass deviceClass,
+                                                    DeviceRequest *request )
+{
+    DeviceWorker *worker = &devices->workers[ deviceClass ];
+
+    pthread_mutex_lock( &worker->lock );
+
+    while( request->complete == False )
+    {
+        pthread_cond_wait( &worker->workDone, &worker->lock );
+    }
+
+    pthread_mutex_unlock( &worker->lock );
+}
+
+/*
+Function name: postDeviceCompletion
+Algorithm: Pushes a completed request onto the lock-free completion queue
+           with a compare and swap loop, then posts the completion semaphore
+           if the queue was empty
+Precondition: Given device manager and a completed asynchronous request
+Postcondition: Request is visible to the next takeDeviceCompletions call
+Exceptions: None
+Note: Safe to call from any number of worker threads at once; one post
+      covers every completion pushed until the queue is next taken
+*/
+void postDeviceCompletion( DeviceManager *devices, DeviceRequest *request )
+{
+    DeviceRequest *oldHead;
+
+    oldHead = atomic_load_explicit( &devices->completions,
+                                                    memory_order_relaxed );
+    do
+    {
+        request->completionNext = oldHead;
+    }
+    while( atomic_compare_exchange_weak_explicit( &devices->completions,
+                    &oldHead, request, memory_order_release,
+                                            memory_order_relaxed ) == False );
+
+    if( oldHead == NULL )
+    {
+        sem_post( &devices->completionsPosted );
+    }
+}
+
+/*
+Function name: takeDeviceCompletions
+Algorithm: Detaches every posted completion with one atomic exchange,
+           takes back the semaphore post of the detached queue, then
+           reverses the detached list so it is in completion order
+Precondition: Given device manager
+Postcondition: Returns completed requests linked through completionNext in
+               the order they completed, or NULL if there are none
+Exceptions: None
+Note: Cheap enough to call at every cycle boundary when nothing is posted;
+      with several consumers each completion is taken by exactly one; a post
+      not made yet when the queue is taken is left over, and only costs a
+      waiter one extra check
+*/
+DeviceRequest *takeDeviceCompletions( DeviceManager *devices )
+{
+    DeviceRequest *request, *nextRequest, *ordered = NULL;
+
+    if( atomic_load_explicit( &devices->completions,
+                                            memory_order_relaxed ) == NULL )
+    {
+        return NULL;
+    }
+
+    request = atomic_exchange_explicit( &devices->completions, NULL,
+                                                    memory_order_acquire );
+
+    if( request != NULL )
+    {
+        sem_trywait( &devices->completionsPosted );
+    }
+
+    while( request != NULL )
+    {
+        nextRequest = request->completionNext;
+        request->completionNext = ordered;
+        ordered = request;
+        request = nextRequest;
+    }
+
+    return ordered;
+}
+
+/*
+Function name: awaitDeviceCompletion
+Algorithm: Blocks the simulator until a worker posts a completion
+Precondition: Given device manager with at least one asynchronous request
+              outstanding or already posted
+Postcondition: At least one completion has been posted since the last wait
+Exceptions: None
+Note: A posted completion may already have been taken at a cycle boundary,
+      so callers check for completions again after waking
+*/
+void awaitDeviceCompletion( DeviceManager *devices )
+{
+    while( sem_wait( &devices->completionsPosted ) != 0 )
+    {
+        // restart the wait if it was interrupted
+    }
+}
+
+/*
+Function name: nextDeviceDeadline
+Algorithm: Looks at the earliest asynchronous request queued on each device
+           and returns the earliest ending time among them
+Precondition: Given device manager
+Postcondition: Returns the time the next asynchronous request completes,
+               or -1 if none is outstanding
+Exceptions: None
+Note: Requests already posted to the completion queue are not counted
+*/
+SimTime nextDeviceDeadline( DeviceManager *devices )
+{
+    DeviceWorker *worker;
+    DeviceRequest *request;
+    SimTime deadline = -1;
+    int deviceClass;
+
+    for( deviceClass = 0; deviceClass < DEVICE_CLASS_COUNT; deviceClass++ )
+    {
+        worker = &devices->workers[ deviceClass ];
+
+        pthread_mutex_lock( &worker->lock );
+
+        request = worker->head;
+        while( request != NULL && request->isAsync == False )
+        {
+            request = request->next;
+        }
+
+        if( request != NULL
+                        && ( deadline < 0 || request->endingTime < deadline ) )
+        {
+            deadline = request->endingTime;
+        }
+
+        pthread_mutex_unlock( &worker->lock );
+    }
+
+    return deadline;
+}
+
+/*
+Function name: wakeDeviceCompletionWaiter
+Algorithm: Posts the completion semaphore without posting a completion
+Precondition: Given device manager
+Postcondition: A thread blocked in awaitDeviceCompletion returns
+Exceptions: None
+Note: Used to release the waiting core once no process is left to wait for
+*/
+void wakeDeviceCompletionWaiter( DeviceManager *devices )
+{
+    sem_post( &devices->completionsPosted );
+}
+
+/*
+Function name: runDeviceWorker
+Algorithm: Thread body of a device worker; takes the earliest request from
+           its work queue; a synchronous request lets its time pass on the
+           simulator clock and is marked complete, an asynchronous request is
+           waited for until its ending time and then posted to the completion
+           queue; repeats until it is shut down
+Precondition: Given pointer to an initialized device worker
+Postcondition: Worker has drained its queue and exited
+Exceptions: None
+Note: A timed wait is cut short when an earlier request is submitted
+*/
+void *runDeviceWorker( void *worker )
+{
+    DeviceWorker *device = (DeviceWorker *)worker;
+    DeviceRequest *request;
+    struct timespec deadline;
+
+    pthread_mutex_lock( &device->lock );
+
+    while( True )
+    {
+        while( device->head == NULL && device->shutdown == False )
+        {
+            pthread_cond_wait( &device->workReady, &device->lock );
+        }
+
+        if( device->head == NULL )
+        {
+            break;
+        }
+
+        request = device->head;
+
+        if( request->isAsync == True
+                        && accessClock( LAP_TIMER ) < request->endingTime )
+        {
+            simTimeToDeadline( request->endingTime, &deadline );
+            pthread_cond_timedwait( &device->workReady, &device->lock,
+                                                                &deadline );
+            continue;
+        }
+
+        device->head = request->next;
+        pthread_mutex_unlock( &device->lock );
+
+        if( request->isAsync == True )
+        {
+            postDeviceCompletion( device->devices, request );
+            pthread_mutex_lock( &device->lock );
+        }
+        else
+        {
+            runClock( request->milliSeconds );
+
+            pthread_mutex_lock( &device->lock );
+            request->complete = True;
+            pthread_cond_broadcast( &device->workDone );
+        }
+    }
+
+    pthread_mutex_unlock( &device->lock );
+    return NULL;
+}
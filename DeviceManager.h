@@ -0,0 +1,87 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: DeviceManager.h
+Brief: Header file for simulated device worker code
+Details: Specifies functions, constants, and other information
+         related to simulated device worker code
+Version: 1.0
+         17 October 2026
+         Initial development of DeviceManager code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef DEVICE_MANAGER_H
+#define DEVICE_MANAGER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include "MetaDataAccess.h"
+#include "SimClock.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef enum DeviceClass
+{
+    PROCESSOR_DEVICE,
+    HARD_DRIVE_DEVICE,
+    KEYBOARD_DEVICE,
+    MONITOR_DEVICE,
+    PRINTER_DEVICE,
+    SWAP_DEVICE,
+    DEVICE_CLASS_COUNT
+} DeviceClass;
+
+typedef struct DeviceRequest
+{
+    int PID;
+    int milliSeconds;
+    Boolean isAsync;
+    SimTime endingTime;
+    char *opType;
+    char *opName;
+    Boolean complete;
+    struct DeviceRequest *next;
+    struct DeviceRequest *completionNext;
+} DeviceRequest;
+
+typedef struct DeviceWorker
+{
+    pthread_t threadID;
+    pthread_mutex_t lock;
+    pthread_cond_t workReady;
+    pthread_cond_t workDone;
+    DeviceRequest *head;
+    Boolean started;
+    Boolean shutdown;
+    struct DeviceManager *devices;
+} DeviceWorker;
+
+typedef struct DeviceManager
+{
+    DeviceWorker workers[ DEVICE_CLASS_COUNT ];
+    _Atomic( DeviceRequest * ) completions;
+    sem_t completionsPosted;
+} DeviceManager;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+DeviceManager *startDevices( void );
+DeviceManager *stopDevices( DeviceManager *devices );
+DeviceClass getDeviceClass( OpCodeType *opCode );
+void submitDeviceOp( DeviceManager *devices, DeviceClass deviceClass,
+                                                    DeviceRequest *request );
+void awaitDeviceOp( DeviceManager *devices, DeviceClass deviceClass,
+                                                    DeviceRequest *request );
+void postDeviceCompletion( DeviceManager *devices, DeviceRequest *request );
+DeviceRequest *takeDeviceCompletions( DeviceManager *devices );
+void awaitDeviceCompletion( DeviceManager *devices );
+void wakeDeviceCompletionWaiter( DeviceManager *devices );
+SimTime nextDeviceDeadline( DeviceManager *devices );
+void *runDeviceWorker( void *worker );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // DEVICE_MANAGER_H
@@ -0,0 +1,215 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: EdfScheduler.c
+Brief: Implementation file for earliest-deadline-first scheduling code
+Details: Implements the EDF-P policy; READY processes are kept in a heap
+         keyed on the deadline named by their A(end) line, and the finish
+         time of every process is checked against its deadline; the
+         deadline accounting is kept once for the schedulers of every core
+Version: 1.0
+         17 October 2026
+         Initial development of EdfScheduler code
+Note: Processes without a deadline run only when no process with one is
+      READY
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "EdfScheduler.h"
+
+/*
+Function name: createEdfPolicy
+Algorithm: Builds a heap keyed on deadline, takes the per-PID deadline
+           and finish time accounting from shareWith or builds it here, and
+           sets the EDF hooks of the scheduler
+Precondition: Given scheduler, simulator config, number of processes, and
+              EDF scheduler of another core, or NULL
+Postcondition: Scheduler runs EDF-P with no READY process
+Exceptions: None
+Note: Preemption happens at the configured quantum and at every I/O
+      completion, where the earliest deadline is picked again; the
+      deadlines come from the pcbs, so the config is not needed here
+*/
+void createEdfPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith )
+{
+    EdfPolicy *policy = (EdfPolicy *)malloc( sizeof( EdfPolicy ) );
+    EdfShare *share;
+    int pid;
+
+    (void)configDataPtr;
+
+    policy->ready = createPcbHeap( pcbCount, HEAP_KEY_DEADLINE );
+
+    if( shareWith != NULL )
+    {
+        share = (EdfShare *)shareWith->sharedData;
+    }
+    else
+    {
+        share = (EdfShare *)malloc( sizeof( EdfShare ) );
+        share->pcbCount = pcbCount;
+        share->deadlines = (SimTime *)malloc( pcbCount * sizeof( SimTime ) );
+        share->finishTimes = (SimTime *)malloc( pcbCount
+                                                        * sizeof( SimTime ) );
+
+        for( pid = 0; pid < pcbCount; pid++ )
+        {
+            share->deadlines[ pid ] = 0;
+            share->finishTimes[ pid ] = -1;
+        }
+
+        scheduler->ownsShared = True;
+    }
+
+    policy->share = share;
+
+    scheduler->policyData = policy;
+    scheduler->sharedData = share;
+    scheduler->preemptive = True;
+    scheduler->enqueue = edfEnqueue;
+    scheduler->onWake = edfEnqueue;
+    scheduler->pickNext = edfPickNext;
+    scheduler->onExit = edfExit;
+    scheduler->report = edfReport;
+    scheduler->clearPolicy = clearEdfPolicy;
+}
+
+/*
+Function name: edfEnqueue
+Algorithm: Records the deadline of the pcb and pushes it onto the heap
+Precondition: Given EDF scheduler and a READY pcb not in the heap
+Postcondition: Pcb is in the heap at its place by deadline
+Exceptions: None
+Note: O(log n); only the core holding a pcb writes its entries, so the
+      shared accounting needs no lock
+*/
+void edfEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    EdfPolicy *policy = (EdfPolicy *)scheduler->policyData;
+
+    policy->share->deadlines[ pcb->PID ] = pcb->deadline;
+    pushPcbHeap( policy->ready, pcb );
+}
+
+/*
+Function name: edfPickNext
+Algorithm: Pops the pcb with the earliest deadline
+Precondition: Given EDF scheduler
+Postcondition: Returns pcb to run, or NULL if none is READY
+Exceptions: None
+Note: O(log n)
+*/
+PcbType *edfPickNext( Scheduler *scheduler )
+{
+    EdfPolicy *policy = (EdfPolicy *)scheduler->policyData;
+
+    return popPcbHeap( policy->ready );
+}
+
+/*
+Function name: edfExit
+Algorithm: Records the time the pcb finished
+Precondition: Given EDF scheduler and a pcb set in EXIT state
+Postcondition: Finish time of the pcb is stored by PID
+Exceptions: None
+Note: None
+*/
+void edfExit( Scheduler *scheduler, PcbType *pcb )
+{
+    EdfPolicy *policy = (EdfPolicy *)scheduler->policyData;
+
+    policy->share->deadlines[ pcb->PID ] = pcb->deadline;
+    policy->share->finishTimes[ pcb->PID ] = accessClock( LAP_TIMER );
+}
+
+/*
+Function name: edfReport
+Algorithm: Logs the deadline, finish time, and tardiness of every process
+           with a deadline that finished, then the number of deadlines
+           missed with the total and worst tardiness
+Precondition: Given EDF scheduler, config, and output log
+Postcondition: Deadline summary is displayed and/or stored in the log
+Exceptions: None
+Note: Tardiness is how far past its deadline a process finished, or zero;
+      the summary covers every core
+*/
+void edfReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog )
+{
+    EdfShare *share = ( (EdfPolicy *)scheduler->policyData )->share;
+    char displayString[ MAX_STR_LEN ];
+    SimTime tardiness, totalTardiness = 0, worstTardiness = 0;
+    int pid, deadlineCount = 0, missCount = 0;
+
+    for( pid = 0; pid < share->pcbCount; pid++ )
+    {
+        if( share->deadlines[ pid ] == 0 || share->finishTimes[ pid ] < 0 )
+        {
+            continue;
+        }
+
+        tardiness = share->finishTimes[ pid ] - share->deadlines[ pid ];
+
+        if( tardiness < 0 )
+        {
+            tardiness = 0;
+        }
+        else if( tardiness > 0 )
+        {
+            missCount++;
+        }
+
+        deadlineCount++;
+        totalTardiness += tardiness;
+
+        if( tardiness > worstTardiness )
+        {
+            worstTardiness = tardiness;
+        }
+
+        sprintf( displayString,
+            "OS: Process %d, deadline %lld ms, finished %lld ms, "
+                                                    "%lld ms tardy\n",
+            pid, (long long)( share->deadlines[ pid ] / NSEC_PER_MSEC ),
+            (long long)( share->finishTimes[ pid ] / NSEC_PER_MSEC ),
+            (long long)( tardiness / NSEC_PER_MSEC ) );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+    }
+
+    sprintf( displayString,
+        "OS: EDF %d of %d deadlines missed, %lld ms total tardiness, "
+                                                    "%lld ms worst\n",
+        missCount, deadlineCount,
+        (long long)( totalTardiness / NSEC_PER_MSEC ),
+        (long long)( worstTardiness / NSEC_PER_MSEC ) );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+}
+
+/*
+Function name: clearEdfPolicy
+Algorithm: Frees the heap, the deadline accounting if this scheduler
+           built it, and the policy
+Precondition: Given EDF scheduler
+Postcondition: Policy memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearEdfPolicy( Scheduler *scheduler )
+{
+    EdfPolicy *policy = (EdfPolicy *)scheduler->policyData;
+
+    policy->ready = clearPcbHeap( policy->ready );
+
+    if( scheduler->ownsShared == True )
+    {
+        free( policy->share->deadlines );
+        free( policy->share->finishTimes );
+        free( policy->share );
+    }
+
+    free( policy );
+    scheduler->policyData = NULL;
+    scheduler->sharedData = NULL;
+}
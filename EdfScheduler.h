@@ -0,0 +1,48 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: EdfScheduler.h
+Brief: Header file for earliest-deadline-first scheduling code
+Details: Specifies functions, constants, and other information
+         related to earliest-deadline-first scheduling code
+Version: 1.0
+         17 October 2026
+         Initial development of EdfScheduler code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef EDF_SCHEDULER_H
+#define EDF_SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "Scheduler.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct EdfShare
+{
+    int pcbCount;
+    SimTime *deadlines;
+    SimTime *finishTimes;
+} EdfShare;
+
+typedef struct EdfPolicy
+{
+    PcbHeap *ready;
+    EdfShare *share;
+} EdfPolicy;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void createEdfPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith );
+void edfEnqueue( Scheduler *scheduler, PcbType *pcb );
+PcbType *edfPickNext( Scheduler *scheduler );
+void edfExit( Scheduler *scheduler, PcbType *pcb );
+void edfReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog );
+void clearEdfPolicy( Scheduler *scheduler );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // EDF_SCHEDULER_H
@@ -2,7 +2,14 @@
 /*
 File: InterruptHandling.c
 Brief: Implementation file for InterruptHandling code
-Details: Implements all functions of the InterruptHandling utilities
+Details: Implements all functions of the InterruptHandling utilities;
+         pending interrupts are kept in a binary min-heap ordered by ending
+         time, with ties kept in the order the interrupts were added;
+         interrupt records come from a free list refilled a block at a
+         time, and each holds its op type and name as ids into a table of
+         the distinct strings seen; optionally a hierarchical timing wheel
+         with one millisecond slots holds the interrupts due after the
+         current slot, and the heap only holds those due within it
 Version: 1.0
          24 April 2019
          Initial development of InterruptHandling code
@@ -13,74 +20,146 @@ Note: None
 #include "InterruptHandling.h"
 
 /*
-Function name: addInterrupt
-Algorithm: Creates a new inturrupt node and adds it to the interruptQueue link
-           list.
-Precondition: Given a pointer to an interruptQueue
-Postcondition: Return interruptQueue with node added and sorted by endingTime
+Function name: createInterruptQueue
+Algorithm: Allocates an empty interrupt heap with room for the given number
+           of interrupts, and an empty timing wheel when one is asked for
+Precondition: Given starting capacity and whether to use a timing wheel
+Postcondition: Returns empty interrupt queue
 Exceptions: None
-Note: None
+Note: The heap doubles in size when it fills
 */
-
-Interrupt *addInterrupt( Interrupt *interruptQueue, int pid, char *opType,
-    char *opName, float endingTime )
+InterruptQueue *createInterruptQueue( int capacity, Boolean useWheel )
 {
-    Interrupt *currentInterrupt, *tempInterrupt;
+    InterruptQueue *interruptQueue = malloc( sizeof( InterruptQueue ) );
+    int level, slot;
 
-    if( interruptQueue == NULL )
+    if( capacity < 1 )
     {
-        interruptQueue = malloc( sizeof( Interrupt ) );
-        interruptQueue->PID = pid;
-        copyString( interruptQueue->opType, opType );
-        copyString( interruptQueue->opName, opName );
-        interruptQueue->endingTime = endingTime;
-        interruptQueue->next = NULL;
-
-        return interruptQueue;
+        capacity = 1;
     }
-    else
+
+    interruptQueue->nodes = malloc( capacity * sizeof( Interrupt * ) );
+    interruptQueue->size = 0;
+    interruptQueue->capacity = capacity;
+    interruptQueue->nextSequence = 0;
+    interruptQueue->freeList = NULL;
+    interruptQueue->blocks = NULL;
+    interruptQueue->opStrings =
+                        malloc( DEFAULT_OP_STRING_CAPACITY * sizeof( char * ) );
+    interruptQueue->opStringCount = 0;
+    interruptQueue->opStringCapacity = DEFAULT_OP_STRING_CAPACITY;
+    interruptQueue->wheel = NULL;
+    interruptQueue->batch = malloc( capacity * sizeof( Interrupt ) );
+    interruptQueue->batchCapacity = capacity;
+
+    if( useWheel == True )
     {
-        currentInterrupt = interruptQueue;
+        interruptQueue->wheel = malloc( sizeof( TimingWheel ) );
+        interruptQueue->wheel->cursor = 0;
+        interruptQueue->wheel->overflow = NULL;
+        interruptQueue->wheel->count = 0;
 
-        if( endingTime < currentInterrupt->endingTime )
+        for( level = 0; level < WHEEL_LEVELS; level++ )
         {
-            interruptQueue = malloc( sizeof( Interrupt ) );
-            interruptQueue->PID = pid;
-            copyString( interruptQueue->opType, opType );
-            copyString( interruptQueue->opName, opName );
-            interruptQueue->endingTime = endingTime;
-            interruptQueue->next = currentInterrupt;
-
-            return interruptQueue;
-        }
+            interruptQueue->wheel->occupied[ level ] = 0;
 
-        while( currentInterrupt->next != NULL )
-        {
-            if( endingTime < currentInterrupt->endingTime )
+            for( slot = 0; slot < WHEEL_SLOTS; slot++ )
             {
-                tempInterrupt = currentInterrupt;
-                currentInterrupt->next = malloc( sizeof( Interrupt ) );
-                currentInterrupt->next->PID = pid;
-                copyString( currentInterrupt->next->opType, opType );
-                copyString(currentInterrupt->next->opName, opName );
-                currentInterrupt->next->endingTime = endingTime;
-                currentInterrupt->next->next = tempInterrupt;
-
-                return interruptQueue;
+                interruptQueue->wheel->slots[ level ][ slot ] = NULL;
             }
-
-            currentInterrupt = currentInterrupt->next;
         }
+    }
+
+    return interruptQueue;
+}
+
+/*
+Function name: addInterrupt
+Algorithm: Takes a record from the pool, fills it in with the op type and
+           name interned, and adds it to the timing wheel if there is one,
+           or else to the heap
+Precondition: Given interruptQueue and the interrupt data
+Postcondition: Return interruptQueue with node added in endingTime order
+Exceptions: None
+Note: O(log n) with the heap, O(1) with the wheel; no memory is allocated
+      once the pool and string table have grown to the workload
+*/
+InterruptQueue *addInterrupt( InterruptQueue *interruptQueue, int pid,
+    char *opType, char *opName, SimTime endingTime )
+{
+    Interrupt *newInterrupt = takeInterruptRecord( interruptQueue );
+
+    newInterrupt->PID = pid;
+    newInterrupt->opTypeId = internOpString( interruptQueue, opType );
+    newInterrupt->opNameId = internOpString( interruptQueue, opName );
+    newInterrupt->endingTime = endingTime;
+    newInterrupt->sequence = interruptQueue->nextSequence;
+    interruptQueue->nextSequence++;
+
+    if( interruptQueue->wheel != NULL )
+    {
+        addWheelInterrupt( interruptQueue, newInterrupt );
+    }
+    else
+    {
+        pushInterruptHeap( interruptQueue, newInterrupt );
+    }
+
+    return interruptQueue;
+}
 
-        currentInterrupt->next = malloc( sizeof( Interrupt ) );
-        currentInterrupt->next->PID = pid;
-        copyString( currentInterrupt->next->opType, opType );
-        copyString(currentInterrupt->next->opName, opName );
-        currentInterrupt->next->endingTime = endingTime;
-        currentInterrupt->next->next = NULL;
+/*
+Function name: peekInterrupt
+Algorithm: Returns the root of the heap; with a timing wheel, an empty heap
+           is first filled from the earliest occupied slot of the wheel
+Precondition: Given interruptQueue
+Postcondition: Returns interrupt with the earliest endingTime, or NULL if
+               the queue is empty
+Exceptions: None
+Note: O(1) with the heap; amortized O(1) with the wheel
+*/
+Interrupt *peekInterrupt( InterruptQueue *interruptQueue )
+{
+    if( interruptQueue->size == 0 && interruptQueue->wheel != NULL
+                                        && interruptQueue->wheel->count > 0 )
+    {
+        advanceWheel( interruptQueue );
+    }
 
-        return interruptQueue;
+    if( interruptQueue->size == 0 )
+    {
+        return NULL;
     }
+
+    return interruptQueue->nodes[ 0 ];
+}
+
+/*
+Function name: getInterruptOpType
+Algorithm: Looks up the interned op type of the interrupt
+Precondition: Given interruptQueue and one of its interrupts
+Postcondition: Returns op type string, such as input or output
+Exceptions: None
+Note: The string belongs to the queue and lasts until it is cleared
+*/
+char *getInterruptOpType( InterruptQueue *interruptQueue,
+                                                    Interrupt *interrupt )
+{
+    return interruptQueue->opStrings[ interrupt->opTypeId ];
+}
+
+/*
+Function name: getInterruptOpName
+Algorithm: Looks up the interned op name of the interrupt
+Precondition: Given interruptQueue and one of its interrupts
+Postcondition: Returns op name string, such as the device name
+Exceptions: None
+Note: The string belongs to the queue and lasts until it is cleared
+*/
+char *getInterruptOpName( InterruptQueue *interruptQueue,
+                                                    Interrupt *interrupt )
+{
+    return interruptQueue->opStrings[ interrupt->opNameId ];
 }
 
 /*
@@ -90,14 +169,16 @@ Algorithm: Checks if interruptQueue has an interupt with a endingTime less than
 Precondition: Given interruptQueue to check
 Postcondition: Return Boolean value if interrupt is found
 Exceptions: None
-Note: None
+Note: O(1); only the earliest interrupt needs to be looked at
 */
 
-Boolean haveInterrupt( Interrupt *interruptQueue, float currentTime )
+Boolean haveInterrupt( InterruptQueue *interruptQueue, SimTime currentTime )
 {
-    if( interruptQueue != NULL )
+    Interrupt *firstInterrupt = peekInterrupt( interruptQueue );
+
+    if( firstInterrupt != NULL )
     {
-        if( currentTime >= interruptQueue->endingTime )
+        if( currentTime >= firstInterrupt->endingTime )
         {
             return True;
         }
@@ -109,46 +190,99 @@ Boolean haveInterrupt( Interrupt *interruptQueue, float currentTime )
 
 /*
 Function name: removeInterupt
-Algorithm: Removes the first node of an interupt queue and returns back the
-           queue.
-Precondition: Given non-empty interruptQueue list
-Postcondition: Returned interruptQueue minus the head
+Algorithm: Returns the root of the heap to the pool, moves the last node to
+           the root, and sifts it down to its place
+Precondition: Given non-empty interruptQueue
+Postcondition: Returned interruptQueue minus its earliest interrupt
 Exceptions: None
-Note: None
+Note: O(log n); an interrupt taken from peekInterrupt may not be used
+      after it is removed
 */
 
-Interrupt *removeInterupt( Interrupt **interruptQueue )
+InterruptQueue *removeInterupt( InterruptQueue *interruptQueue )
+{
+    interruptQueue->nodes[ 0 ]->next = interruptQueue->freeList;
+    interruptQueue->freeList = interruptQueue->nodes[ 0 ];
+    interruptQueue->size--;
+
+    if( interruptQueue->size > 0 )
+    {
+        interruptQueue->nodes[ 0 ] =
+                            interruptQueue->nodes[ interruptQueue->size ];
+        siftInterruptDown( interruptQueue, 0 );
+    }
+
+    return interruptQueue;
+}
+
+/*
+Function name: drainInterrupts
+Algorithm: Pops every interrupt due by the current time, in order, copying
+           each into the batch of the queue
+Precondition: Given interruptQueue and current time
+Postcondition: Returns number of interrupts in the batch, which is in
+               endingTime order; the popped records are back in the pool
+Exceptions: None
+Note: The batch is only valid until the next drain; its op type and name
+      are still read through getInterruptOpType and getInterruptOpName
+*/
+int drainInterrupts( InterruptQueue *interruptQueue, SimTime currentTime )
 {
-    Interrupt *tempInterrupt;
+    int count = 0;
 
-    tempInterrupt = *interruptQueue;
-    tempInterrupt = tempInterrupt->next;
-    free(*interruptQueue);
-    *interruptQueue = tempInterrupt;
+    while( haveInterrupt( interruptQueue, currentTime ) )
+    {
+        if( count == interruptQueue->batchCapacity )
+        {
+            interruptQueue->batchCapacity *= 2;
+            interruptQueue->batch = realloc( interruptQueue->batch,
+                        interruptQueue->batchCapacity * sizeof( Interrupt ) );
+        }
 
-    return *interruptQueue;
+        interruptQueue->batch[ count ] = *peekInterrupt( interruptQueue );
+        interruptQueue = removeInterupt( interruptQueue );
+        count++;
+    }
+
+    return count;
 }
 
 /*
 Function name: clearInterruptQueue
-Algorithm: Recusively calls itself through a Interrupt queue,
-           returns memeory to OS from the bottom of the list upward
-Precondition: Given Interrupt queue, with or without data
+Algorithm: Frees every block of interrupt records and every interned
+           string, then the heap itself
+Precondition: Given Interrupt queue, with or without data, or NULL
 Postcondition: All node memory, if any, is returned to OS,
-               return pointer (head) is set to null
+               return pointer is set to null
 Exceptions: None
 Note: None
 */
-Interrupt *clearInterruptQueue( Interrupt *interruptQueue )
+InterruptQueue *clearInterruptQueue( InterruptQueue *interruptQueue )
 {
+    InterruptBlock *block;
+    int index;
+
     if( interruptQueue != NULL )
     {
-        if( interruptQueue->next != NULL )
+        while( interruptQueue->blocks != NULL )
         {
-            clearInterruptQueue( interruptQueue->next );
+            block = interruptQueue->blocks;
+            interruptQueue->blocks = block->next;
+            free( block );
         }
+
+        for( index = 0; index < interruptQueue->opStringCount; index++ )
+        {
+            free( interruptQueue->opStrings[ index ] );
+        }
+
+        free( interruptQueue->opStrings );
+        free( interruptQueue->nodes );
+        free( interruptQueue->wheel );
+        free( interruptQueue->batch );
         free( interruptQueue );
     }
+
     return NULL;
 }
 
@@ -158,17 +292,383 @@ Algorithm: Displays data from InterruptQueue nodes for testing
 Precondition: Given an InterruptQueue
 Postcondition: All processes in interrupts have there information displayed
 Exceptions: None
-Note: Used for debugging and not for simulator operation
+Note: Used for debugging and not for simulator operation; the heap is
+      shown in heap order, which starts with the earliest but is not
+      sorted, and interrupts still in a timing wheel are not shown
+*/
+void displayInterruptQueue( InterruptQueue *interruptQueue )
+{
+    char timeStr[ STD_STR_LEN ];
+    Interrupt *interrupt;
+    int index;
+
+    for( index = 0; index < interruptQueue->size; index++ )
+    {
+        interrupt = interruptQueue->nodes[ index ];
+        printf( "PID            : %d\n", interrupt->PID );
+        printf( "opType          : %s\n",
+                        getInterruptOpType( interruptQueue, interrupt ) );
+        printf( "opName          : %s\n",
+                        getInterruptOpName( interruptQueue, interrupt ) );
+        simTimeToString( interrupt->endingTime, timeStr );
+        printf( "Ending time : %s\n\n", timeStr );
+    }
+}
+
+/*
+Function name: interruptBefore
+Algorithm: Compares ending times, then the order the interrupts were added
+Precondition: Given two interrupts
+Postcondition: Returns True if the first is due before the second
+Exceptions: None
+Note: Interrupts due at the same time come out in the order they were added
+*/
+Boolean interruptBefore( Interrupt *first, Interrupt *second )
+{
+    if( first->endingTime != second->endingTime )
+    {
+        return first->endingTime < second->endingTime;
+    }
+
+    return first->sequence < second->sequence;
+}
+
+/*
+Function name: siftInterruptUp
+Algorithm: Moves the interrupt at the index up past every parent due after
+           it
+Precondition: Given interruptQueue and an index in the heap
+Postcondition: Interrupt is no lower than its place by endingTime
+Exceptions: None
+Note: None
+*/
+void siftInterruptUp( InterruptQueue *interruptQueue, int index )
+{
+    Interrupt *interrupt = interruptQueue->nodes[ index ];
+    int parent;
+
+    while( index > 0 )
+    {
+        parent = ( index - 1 ) / 2;
+
+        if( interruptBefore( interrupt,
+                            interruptQueue->nodes[ parent ] ) == False )
+        {
+            break;
+        }
+
+        interruptQueue->nodes[ index ] = interruptQueue->nodes[ parent ];
+        index = parent;
+    }
+
+    interruptQueue->nodes[ index ] = interrupt;
+}
+
+/*
+Function name: siftInterruptDown
+Algorithm: Moves the interrupt at the index down past every child due
+           before it, taking the earlier child each time
+Precondition: Given interruptQueue and an index in the heap
+Postcondition: Interrupt is no higher than its place by endingTime
+Exceptions: None
+Note: None
+*/
+void siftInterruptDown( InterruptQueue *interruptQueue, int index )
+{
+    Interrupt *interrupt = interruptQueue->nodes[ index ];
+    int child;
+
+    while( ( child = 2 * index + 1 ) < interruptQueue->size )
+    {
+        if( child + 1 < interruptQueue->size
+            && interruptBefore( interruptQueue->nodes[ child + 1 ],
+                                interruptQueue->nodes[ child ] ) == True )
+        {
+            child++;
+        }
+
+        if( interruptBefore( interruptQueue->nodes[ child ],
+                                                    interrupt ) == False )
+        {
+            break;
+        }
+
+        interruptQueue->nodes[ index ] = interruptQueue->nodes[ child ];
+        index = child;
+    }
+
+    interruptQueue->nodes[ index ] = interrupt;
+}
+
+/*
+Function name: takeInterruptRecord
+Algorithm: Pops a record off the free list, first refilling the list with
+           a new block of INTERRUPT_BLOCK_SIZE records when it is empty
+Precondition: Given interruptQueue
+Postcondition: Returns an unused interrupt record owned by the queue
+Exceptions: None
+Note: O(1); blocks are only returned to OS by clearInterruptQueue
+*/
+Interrupt *takeInterruptRecord( InterruptQueue *interruptQueue )
+{
+    InterruptBlock *block;
+    Interrupt *record;
+    int index;
+
+    if( interruptQueue->freeList == NULL )
+    {
+        block = malloc( sizeof( InterruptBlock ) );
+        block->next = interruptQueue->blocks;
+        interruptQueue->blocks = block;
+
+        for( index = 0; index < INTERRUPT_BLOCK_SIZE; index++ )
+        {
+            block->records[ index ].next = interruptQueue->freeList;
+            interruptQueue->freeList = &block->records[ index ];
+        }
+    }
+
+    record = interruptQueue->freeList;
+    interruptQueue->freeList = record->next;
+
+    return record;
+}
+
+/*
+Function name: internOpString
+Algorithm: Searches the string table of the queue for the string and adds
+           a copy of it when it is not there yet
+Precondition: Given interruptQueue and op type or name string
+Postcondition: Returns the id of the string in the table
+Exceptions: None
+Note: The table only holds the distinct op types and device names of the
+      metadata, so the search is over a handful of short strings
+*/
+short internOpString( InterruptQueue *interruptQueue, char *opString )
+{
+    int index;
+
+    for( index = 0; index < interruptQueue->opStringCount; index++ )
+    {
+        if( compareString( interruptQueue->opStrings[ index ],
+                                                        opString ) == 0 )
+        {
+            return (short)index;
+        }
+    }
+
+    if( interruptQueue->opStringCount == interruptQueue->opStringCapacity )
+    {
+        interruptQueue->opStringCapacity *= 2;
+        interruptQueue->opStrings = realloc( interruptQueue->opStrings,
+                        interruptQueue->opStringCapacity * sizeof( char * ) );
+    }
+
+    interruptQueue->opStrings[ index ] =
+                                malloc( getStringLength( opString ) + 1 );
+    copyString( interruptQueue->opStrings[ index ], opString );
+    interruptQueue->opStringCount++;
+
+    return (short)index;
+}
+
+/*
+Function name: pushInterruptHeap
+Algorithm: Places the interrupt at the end of the heap and sifts it up to
+           its place by endingTime
+Precondition: Given interruptQueue and a filled in interrupt record
+Postcondition: Interrupt is in the heap
+Exceptions: None
+Note: O(log n)
+*/
+void pushInterruptHeap( InterruptQueue *interruptQueue, Interrupt *interrupt )
+{
+    if( interruptQueue->size == interruptQueue->capacity )
+    {
+        interruptQueue->capacity *= 2;
+        interruptQueue->nodes = realloc( interruptQueue->nodes,
+                            interruptQueue->capacity * sizeof( Interrupt * ) );
+    }
+
+    interruptQueue->nodes[ interruptQueue->size ] = interrupt;
+    interruptQueue->size++;
+    siftInterruptUp( interruptQueue, interruptQueue->size - 1 );
+}
+
+/*
+Function name: addWheelInterrupt
+Algorithm: Finds the millisecond tick the interrupt is due in; one at or
+           before the wheel cursor goes to the heap, and a later one goes
+           in the slot of the lowest level whose higher bits it shares with
+           the cursor, or in the overflow list past the top level
+Precondition: Given interruptQueue with a timing wheel and a filled in
+              interrupt record
+Postcondition: Interrupt is in the heap or in the wheel
+Exceptions: None
+Note: O(1) unless it goes to the heap, which only holds the interrupts of
+      the current tick
 */
-void displayInterruptQueue( Interrupt *interruptQueue )
+void addWheelInterrupt( InterruptQueue *interruptQueue, Interrupt *interrupt )
 {
+    TimingWheel *wheel = interruptQueue->wheel;
+    long long tick = interrupt->endingTime / NSEC_PER_MSEC;
+    int level, slot, shift;
+
+    if( tick <= wheel->cursor )
+    {
+        pushInterruptHeap( interruptQueue, interrupt );
+        return;
+    }
+
+    wheel->count++;
+
+    for( level = 0; level < WHEEL_LEVELS; level++ )
+    {
+        shift = WHEEL_SLOT_BITS * ( level + 1 );
+
+        if( ( tick >> shift ) == ( wheel->cursor >> shift ) )
+        {
+            slot = (int)( ( tick >> ( WHEEL_SLOT_BITS * level ) )
+                                                        & ( WHEEL_SLOTS - 1 ) );
+            interrupt->next = wheel->slots[ level ][ slot ];
+            wheel->slots[ level ][ slot ] = interrupt;
+            wheel->occupied[ level ] |= 1ULL << slot;
+            return;
+        }
+    }
+
+    interrupt->next = wheel->overflow;
+    wheel->overflow = interrupt;
+}
+
+/*
+Function name: advanceWheel
+Algorithm: Moves the cursor to the next occupied level 0 slot after it and
+           moves that slot's interrupts to the heap; when level 0 has none,
+           the cursor moves to the next occupied slot of the lowest level
+           that has one and that slot is cascaded to the levels below;
+           when every level is empty the cursor moves to the block of the
+           earliest overflow interrupt and the overflow list is placed again
+Precondition: Given interruptQueue with a timing wheel holding at least one
+              interrupt and an empty heap
+Postcondition: Heap holds every interrupt of the earliest tick in the wheel
+Exceptions: None
+Note: Occupied slots are found from a bitmap per level, so empty slots
+      are skipped without being visited; the cursor may pass the current
+      time, and an interrupt later added before it goes to the heap
+*/
+void advanceWheel( InterruptQueue *interruptQueue )
+{
+    TimingWheel *wheel = interruptQueue->wheel;
+    Interrupt *interrupt, *nextInterrupt;
+    unsigned long long candidates;
+    long long earliestTick, tick;
+    int level, slot, shift, topShift;
+
+    while( interruptQueue->size == 0 )
+    {
+        slot = (int)( wheel->cursor & ( WHEEL_SLOTS - 1 ) );
+        candidates = wheel->occupied[ 0 ] & ( ~0ULL << slot );
+
+        if( candidates != 0 )
+        {
+            slot = __builtin_ctzll( candidates );
+            wheel->cursor = ( wheel->cursor >> WHEEL_SLOT_BITS
+                                                << WHEEL_SLOT_BITS ) | slot;
+            interrupt = wheel->slots[ 0 ][ slot ];
+            wheel->slots[ 0 ][ slot ] = NULL;
+            wheel->occupied[ 0 ] &= ~( 1ULL << slot );
+
+            while( interrupt != NULL )
+            {
+                nextInterrupt = interrupt->next;
+                wheel->count--;
+                pushInterruptHeap( interruptQueue, interrupt );
+                interrupt = nextInterrupt;
+            }
+
+            continue;
+        }
+
+        for( level = 1; level < WHEEL_LEVELS; level++ )
+        {
+            shift = WHEEL_SLOT_BITS * level;
+            topShift = shift + WHEEL_SLOT_BITS;
+            slot = (int)( ( wheel->cursor >> shift ) & ( WHEEL_SLOTS - 1 ) );
+            candidates = 0;
+
+            if( slot < WHEEL_SLOTS - 1 )
+            {
+                candidates = wheel->occupied[ level ]
+                                                & ( ~0ULL << ( slot + 1 ) );
+            }
+
+            if( candidates != 0 )
+            {
+                slot = __builtin_ctzll( candidates );
+                wheel->cursor = ( wheel->cursor >> topShift << topShift )
+                                                | ( (long long)slot << shift );
+                cascadeWheelSlot( interruptQueue, level, slot );
+                break;
+            }
+        }
+
+        if( level == WHEEL_LEVELS )
+        {
+            topShift = WHEEL_SLOT_BITS * WHEEL_LEVELS;
+            earliestTick = -1;
+
+            for( interrupt = wheel->overflow; interrupt != NULL;
+                                                interrupt = interrupt->next )
+            {
+                tick = interrupt->endingTime / NSEC_PER_MSEC;
+
+                if( earliestTick < 0 || tick < earliestTick )
+                {
+                    earliestTick = tick;
+                }
+            }
+
+            wheel->cursor = ( earliestTick >> topShift ) << topShift;
+            interrupt = wheel->overflow;
+            wheel->overflow = NULL;
+
+            while( interrupt != NULL )
+            {
+                nextInterrupt = interrupt->next;
+                wheel->count--;
+                addWheelInterrupt( interruptQueue, interrupt );
+                interrupt = nextInterrupt;
+            }
+        }
+    }
+}
+
+/*
+Function name: cascadeWheelSlot
+Algorithm: Empties the slot and places each of its interrupts again against
+           the cursor, which has just moved to the start of that slot
+Precondition: Given interruptQueue with a timing wheel, and a level above 0
+              with the slot the cursor now starts
+Postcondition: Interrupts of the slot are in lower levels or the heap
+Exceptions: None
+Note: Every interrupt moves down at most WHEEL_LEVELS - 1 times, which
+      keeps adding and expiring interrupts O(1) amortized
+*/
+void cascadeWheelSlot( InterruptQueue *interruptQueue, int level, int slot )
+{
+    TimingWheel *wheel = interruptQueue->wheel;
+    Interrupt *interrupt, *nextInterrupt;
+
+    interrupt = wheel->slots[ level ][ slot ];
+    wheel->slots[ level ][ slot ] = NULL;
+    wheel->occupied[ level ] &= ~( 1ULL << slot );
 
-    while(interruptQueue != NULL )
+    while( interrupt != NULL )
     {
-        printf( "PID            : %d\n", interruptQueue->PID );
-        printf( "opType          : %s\n", interruptQueue->opType );
-        printf( "opName          : %s\n", interruptQueue->opName );
-        printf( "Ending time : %f\n\n", interruptQueue->endingTime );
-        interruptQueue = interruptQueue->next;
+        nextInterrupt = interrupt->next;
+        wheel->count--;
+        addWheelInterrupt( interruptQueue, interrupt );
+        interrupt = nextInterrupt;
     }
 }
@@ -17,25 +17,83 @@ Note: None
 // Header files ///////////////////////////////////////////////////////////////
 
 #include "StringUtils.h"
+#include "SimClock.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define DEFAULT_INTERRUPT_CAPACITY 64
+#define INTERRUPT_BLOCK_SIZE 64
+#define DEFAULT_OP_STRING_CAPACITY 16
+#define WHEEL_LEVELS 4
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS ( 1 << WHEEL_SLOT_BITS )
 
 // Data Structure Definitions (structs, enums, etc.)//////////////////////////
 
 typedef struct Interrupt
 {
+    SimTime endingTime;
+    long sequence;
     int PID;
-    char opType[ 100 ];
-    char opName[ 100 ];
-    float endingTime;
-    struct  Interrupt *next;
+    short opTypeId;
+    short opNameId;
+    struct Interrupt *next;
 } Interrupt;
 
+typedef struct InterruptBlock
+{
+    Interrupt records[ INTERRUPT_BLOCK_SIZE ];
+    struct InterruptBlock *next;
+} InterruptBlock;
+
+typedef struct TimingWheel
+{
+    long long cursor;
+    Interrupt *slots[ WHEEL_LEVELS ][ WHEEL_SLOTS ];
+    unsigned long long occupied[ WHEEL_LEVELS ];
+    Interrupt *overflow;
+    int count;
+} TimingWheel;
+
+typedef struct InterruptQueue
+{
+    Interrupt **nodes;
+    int size;
+    int capacity;
+    long nextSequence;
+    Interrupt *freeList;
+    InterruptBlock *blocks;
+    char **opStrings;
+    int opStringCount;
+    int opStringCapacity;
+    TimingWheel *wheel;
+    Interrupt *batch;
+    int batchCapacity;
+} InterruptQueue;
+
 // Function Prototypes  ///////////////////////////////////////////////////////
-Interrupt *addInterrupt( Interrupt *interruptQueue, int pid, char *opType,
-    char *opName, float endingTime );
-Boolean haveInterrupt( Interrupt *interruptQueue, float currentTime );
-Interrupt *removeInterupt( Interrupt **interruptQueue );
-Interrupt *clearInterruptQueue( Interrupt *interruptQueue );
-void displayInterruptQueue( Interrupt *interruptQueue );
+InterruptQueue *createInterruptQueue( int capacity, Boolean useWheel );
+InterruptQueue *addInterrupt( InterruptQueue *interruptQueue, int pid,
+    char *opType, char *opName, SimTime endingTime );
+Interrupt *peekInterrupt( InterruptQueue *interruptQueue );
+char *getInterruptOpType( InterruptQueue *interruptQueue,
+                                                    Interrupt *interrupt );
+char *getInterruptOpName( InterruptQueue *interruptQueue,
+                                                    Interrupt *interrupt );
+Boolean haveInterrupt( InterruptQueue *interruptQueue, SimTime currentTime );
+InterruptQueue *removeInterupt( InterruptQueue *interruptQueue );
+int drainInterrupts( InterruptQueue *interruptQueue, SimTime currentTime );
+InterruptQueue *clearInterruptQueue( InterruptQueue *interruptQueue );
+void displayInterruptQueue( InterruptQueue *interruptQueue );
+Boolean interruptBefore( Interrupt *first, Interrupt *second );
+void siftInterruptUp( InterruptQueue *interruptQueue, int index );
+void siftInterruptDown( InterruptQueue *interruptQueue, int index );
+Interrupt *takeInterruptRecord( InterruptQueue *interruptQueue );
+short internOpString( InterruptQueue *interruptQueue, char *opString );
+void pushInterruptHeap( InterruptQueue *interruptQueue, Interrupt *interrupt );
+void addWheelInterrupt( InterruptQueue *interruptQueue, Interrupt *interrupt );
+void advanceWheel( InterruptQueue *interruptQueue );
+void cascadeWheelSlot( InterruptQueue *interruptQueue, int level, int slot );
 
 // Terminating Precompiler Directives ////////////////////////////////////////
 #endif // INTERRUPT_HANDLING_H
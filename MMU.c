@@ -2,11 +2,16 @@
 /*
 File: MMU.c
 Brief: Implementation file for OS memory mangement unit (MMU) code
-Details: Implements all functions of the OS memory mangement unit (MMU)
+Details: Implements all functions of the OS memory mangement unit (MMU);
+         every allocation is indexed twice, in a hash table keyed by PID,
+         segment, and base for access checks, and in a treap ordered by
+         PID, segment, and base for overlap checks
 Version: 1.0
          28 March 2019
          Initial development of MMU code
-Note:
+Note: An allocation of base b and offset o holds addresses b through b + o
+      of its segment, the same addresses an access to it may reach; each
+      segment of each process is its own address space, as under paging
 */
 
 // Header Files ///////////////////////////////////////////////////
@@ -17,50 +22,79 @@ const int BASE_OFFSET = 1000;
 
 /*
 Function name: addMem
-Algorithm: Adds an entry in the MMU table for memory allocation
-Precondition: Given a memory table, PID, memeory segment, memory base, and
-              memory offset
+Algorithm: Adds an entry in the MMU table for memory allocation; the entry
+           goes in the hash bucket of its PID, segment, and base, and in
+           the treap of base ranges
+Precondition: Given a memory table, or NULL, PID, memeory segment, memory
+              base, and memory offset
 Postcondition: Returns memory table with new entry
-Exceptions:
-Note:
+Exceptions: None
+Note: O(1) expected for the hash table and O(log n) expected for the treap
 */
 MMU *addMem(MMU *memory, int procID, int segment, int base, int offset)
 {
-    if( memory == NULL)
+    MmuEntry *entry = (MmuEntry *)malloc( sizeof( MmuEntry ) );
+    unsigned int bucket;
+
+    if( memory == NULL )
     {
-        memory = (MMU *)malloc( sizeof( MMU ) );
-        memory->PID = procID;
-        memory->segment = segment;
-        memory->base = base;
-        memory->offset = offset;
-        memory->next = NULL;
+        memory = createMMU();
     }
-    else
+
+    if( memory->entryCount == memory->bucketCount )
     {
-        memory->next = addMem(memory->next, procID, segment, base, offset);
+        growMmuBuckets( memory );
     }
+
+    entry->PID = procID;
+    entry->segment = segment;
+    entry->base = base;
+    entry->offset = offset;
+    entry->priority = hashMmuKey( procID, segment, base ) * 2654435761u;
+    entry->left = NULL;
+    entry->right = NULL;
+
+    bucket = hashMmuKey( procID, segment, base ) % memory->bucketCount;
+    entry->hashNext = memory->buckets[ bucket ];
+    memory->buckets[ bucket ] = entry;
+    memory->entryCount++;
+
+    memory->ranges = insertMmuRange( memory->ranges, entry );
+
     return memory;
 }
 
 /*
 Function name: isValidAllocate
-Algorithm: Checks MMU table to determine if requested memory allocation is
-           valid
-Precondition: Given memory table, memory base, and memory offset
-Postcondition: Returns False if memory is allready allocated, True if available.
+Algorithm: Finds the allocation of the process and segment with the
+           greatest base at or below the last address requested; the
+           request overlaps an allocation exactly when that one reaches the
+           first address requested
+Precondition: Given memory table, or NULL, PID, memory segment, memory base,
+              and memory offset
+Postcondition: Returns False if any requested address is allready allocated
+               in the segment of the process, True if available.
 Exceptions: None
-Note: None
+Note: O(log n) expected; allocations in a segment never overlap, so the one
+      found is the only one that can
 */
-Boolean isValidAllocate(MMU *memory, int base, int offset)
+Boolean isValidAllocate(MMU *memory, int procID, int segment, int base,
+                                                                    int offset)
 {
-    while( memory != NULL )
+    MmuEntry *before;
+
+    if( memory == NULL )
     {
-        if( memory->base == base )
-        {
-            return False;
-        }
+        return True;
+    }
 
-        memory = memory->next;
+    before = findMmuRangeBefore( memory->ranges, procID, segment,
+                                                            base + offset );
+
+    if( before != NULL && before->PID == procID && before->segment == segment
+                                    && before->base + before->offset >= base )
+    {
+        return False;
     }
 
     return True;
@@ -69,29 +103,30 @@ Boolean isValidAllocate(MMU *memory, int base, int offset)
 /*
 Function name: isValidAccess
 Algorithm: Checks MMU table to determine if requested memory access request is
-           valid. Checks PID, segment ID, and the rquest memory to access.
-Precondition: Given memory table, PID, memory segment, memory base,
+           valid. Looks up the allocation of the PID, segment ID, and base,
+           then checks the rquest memory to access.
+Precondition: Given memory table, or NULL, PID, memory segment, memory base,
               and memory offset
 Postcondition: Returns True if PID has access to the specified memory in the
                MMU, otherwise false.
 Exceptions: None
-Note: None
+Note: O(1) expected
 */
 Boolean isValidAccess(MMU *memory, int procID, int segment, int base,
                                                                     int offset)
 {
-    while( memory != NULL )
+    MmuEntry *entry;
+
+    if( memory == NULL )
     {
-        if( memory->PID == procID && memory->segment == segment
-                                                       && memory->base == base)
-        {
-            if( offset <= memory->offset )
-            {
-                return True;
-            }
-        }
+        return False;
+    }
 
-        memory = memory->next;
+    entry = findMmuEntry( memory, procID, segment, base );
+
+    if( entry != NULL && offset <= entry->offset )
+    {
+        return True;
     }
 
     return False;
@@ -99,23 +134,367 @@ Boolean isValidAccess(MMU *memory, int procID, int segment, int base,
 
 /*
 Function name: clearMMU
-Algorithm: Recusively calls itself through a MMU linked list,
-           returns memeory to OS from the bottom of the list upward
-Precondition: Given MMU, with or without data
+Algorithm: Walks every hash bucket returning its entries to OS, then frees
+           the buckets and the table
+Precondition: Given MMU, with or without data, or NULL
 Postcondition: All node memory, if any, is returned to OS,
                return pointer (head) is set to null
 Exceptions: None
-Note: None
+Note: Every entry is in exactly one bucket, so the treap needs no walk
 */
 MMU *clearMMU( MMU *memory )
 {
+    MmuEntry *entry, *nextEntry;
+    int bucket;
+
     if( memory != NULL )
     {
-        if( memory->next != NULL )
+        for( bucket = 0; bucket < memory->bucketCount; bucket++ )
         {
-            clearMMU( memory->next );
+            entry = memory->buckets[ bucket ];
+
+            while( entry != NULL )
+            {
+                nextEntry = entry->hashNext;
+                free( entry );
+                entry = nextEntry;
+            }
         }
+
+        free( memory->buckets );
         free( memory );
     }
     return NULL;
 }
+
+/*
+Function name: releaseMem
+Algorithm: Walks every hash bucket unlinking the entries of the process,
+           removes each one from the treap, and returns it to the OS
+Precondition: Given memory table, or NULL, and PID
+Postcondition: Returns the total offset of the allocations released, the
+               memory the process was charged for
+Exceptions: None
+Note: O(n) for the bucket walk; used once per process exit
+*/
+int releaseMem( MMU *memory, int procID )
+{
+    MmuEntry **link, *entry;
+    int bucket, released = 0;
+
+    if( memory == NULL )
+    {
+        return 0;
+    }
+
+    for( bucket = 0; bucket < memory->bucketCount; bucket++ )
+    {
+        link = &memory->buckets[ bucket ];
+
+        while( *link != NULL )
+        {
+            entry = *link;
+
+            if( entry->PID == procID )
+            {
+                *link = entry->hashNext;
+                memory->ranges = removeMmuRange( memory->ranges, entry );
+                memory->entryCount--;
+                released += entry->offset;
+                free( entry );
+            }
+            else
+            {
+                link = &entry->hashNext;
+            }
+        }
+    }
+
+    return released;
+}
+
+/*
+Function name: createMMU
+Algorithm: Allocates an empty table with MMU_INITIAL_BUCKETS hash buckets
+Precondition: None
+Postcondition: Returns empty memory table
+Exceptions: None
+Note: None
+*/
+MMU *createMMU( void )
+{
+    MMU *memory = (MMU *)malloc( sizeof( MMU ) );
+    int bucket;
+
+    memory->bucketCount = MMU_INITIAL_BUCKETS;
+    memory->buckets =
+            (MmuEntry **)malloc( memory->bucketCount * sizeof( MmuEntry * ) );
+    memory->entryCount = 0;
+    memory->ranges = NULL;
+
+    for( bucket = 0; bucket < memory->bucketCount; bucket++ )
+    {
+        memory->buckets[ bucket ] = NULL;
+    }
+
+    return memory;
+}
+
+/*
+Function name: hashMmuKey
+Algorithm: Mixes the PID, segment, and base into one value
+Precondition: Given PID, memory segment, and memory base
+Postcondition: Returns hash of the allocation key
+Exceptions: None
+Note: None
+*/
+unsigned int hashMmuKey( int procID, int segment, int base )
+{
+    unsigned int hash = (unsigned int)procID;
+
+    hash = hash * 31u + (unsigned int)segment;
+    hash = hash * 31u + (unsigned int)base;
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bu;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/*
+Function name: findMmuEntry
+Algorithm: Searches the hash bucket of the key for the allocation
+Precondition: Given memory table, PID, memory segment, and memory base
+Postcondition: Returns the allocation, or NULL if there is none
+Exceptions: None
+Note: O(1) expected
+*/
+MmuEntry *findMmuEntry( MMU *memory, int procID, int segment, int base )
+{
+    MmuEntry *entry = memory->buckets[
+            hashMmuKey( procID, segment, base ) % memory->bucketCount ];
+
+    while( entry != NULL )
+    {
+        if( entry->PID == procID && entry->segment == segment
+                                                    && entry->base == base )
+        {
+            return entry;
+        }
+
+        entry = entry->hashNext;
+    }
+
+    return NULL;
+}
+
+/*
+Function name: growMmuBuckets
+Algorithm: Doubles the number of hash buckets and moves every entry to its
+           bucket in the new table
+Precondition: Given memory table
+Postcondition: Table has twice the buckets, holding the same entries
+Exceptions: None
+Note: Keeps the table at no more than one entry per bucket
+*/
+void growMmuBuckets( MMU *memory )
+{
+    MmuEntry **oldBuckets = memory->buckets;
+    MmuEntry *entry, *nextEntry;
+    int oldCount = memory->bucketCount, bucket;
+    unsigned int newBucket;
+
+    memory->bucketCount *= 2;
+    memory->buckets =
+            (MmuEntry **)malloc( memory->bucketCount * sizeof( MmuEntry * ) );
+
+    for( bucket = 0; bucket < memory->bucketCount; bucket++ )
+    {
+        memory->buckets[ bucket ] = NULL;
+    }
+
+    for( bucket = 0; bucket < oldCount; bucket++ )
+    {
+        entry = oldBuckets[ bucket ];
+
+        while( entry != NULL )
+        {
+            nextEntry = entry->hashNext;
+            newBucket = hashMmuKey( entry->PID, entry->segment, entry->base )
+                                                        % memory->bucketCount;
+            entry->hashNext = memory->buckets[ newBucket ];
+            memory->buckets[ newBucket ] = entry;
+            entry = nextEntry;
+        }
+    }
+
+    free( oldBuckets );
+}
+
+/*
+Function name: insertMmuRange
+Algorithm: Inserts the entry by PID, segment, and base as a leaf, then
+           rotates it up past every parent of lower priority on the way back
+Precondition: Given treap root, or NULL, and an entry not in the treap
+Postcondition: Returns root of the treap holding the entry
+Exceptions: None
+Note: O(log n) expected; the priorities come from hashing the key, so the
+      shape does not depend on the order allocations arrive in
+*/
+MmuEntry *insertMmuRange( MmuEntry *root, MmuEntry *entry )
+{
+    MmuEntry *child;
+
+    if( root == NULL )
+    {
+        return entry;
+    }
+
+    if( compareMmuKey( root, entry->PID, entry->segment, entry->base ) > 0 )
+    {
+        root->left = insertMmuRange( root->left, entry );
+
+        if( root->left->priority > root->priority )
+        {
+            child = root->left;
+            root->left = child->right;
+            child->right = root;
+            return child;
+        }
+    }
+    else
+    {
+        root->right = insertMmuRange( root->right, entry );
+
+        if( root->right->priority > root->priority )
+        {
+            child = root->right;
+            root->right = child->left;
+            child->left = root;
+            return child;
+        }
+    }
+
+    return root;
+}
+
+/*
+Function name: removeMmuRange
+Algorithm: Finds the entry by its key, then rotates its child of higher
+           priority above it until it has at most one child, which takes
+           its place
+Precondition: Given treap root and an entry in the treap
+Postcondition: Returns root of the treap without the entry
+Exceptions: None
+Note: O(log n) expected
+*/
+MmuEntry *removeMmuRange( MmuEntry *root, MmuEntry *entry )
+{
+    MmuEntry *child;
+
+    if( root == NULL )
+    {
+        return NULL;
+    }
+
+    if( root != entry )
+    {
+        if( compareMmuKey( root, entry->PID, entry->segment,
+                                                        entry->base ) > 0 )
+        {
+            root->left = removeMmuRange( root->left, entry );
+        }
+        else
+        {
+            root->right = removeMmuRange( root->right, entry );
+        }
+
+        return root;
+    }
+
+    if( root->left == NULL )
+    {
+        return root->right;
+    }
+
+    if( root->right == NULL )
+    {
+        return root->left;
+    }
+
+    if( root->left->priority > root->right->priority )
+    {
+        child = root->left;
+        root->left = child->right;
+        child->right = removeMmuRange( root, entry );
+    }
+    else
+    {
+        child = root->right;
+        root->right = child->left;
+        child->left = removeMmuRange( root, entry );
+    }
+
+    return child;
+}
+
+/*
+Function name: findMmuRangeBefore
+Algorithm: Walks down the treap keeping the last entry whose key is at or
+           below the PID, segment, and address
+Precondition: Given treap root, or NULL, PID, memory segment, and an address
+Postcondition: Returns the entry with the greatest key at or below the
+               given one, or NULL if there is none
+Exceptions: None
+Note: O(log n) expected; the entry found may belong to an earlier segment
+      or process, so callers check its PID and segment
+*/
+MmuEntry *findMmuRangeBefore( MmuEntry *root, int procID, int segment,
+                                                                int address )
+{
+    MmuEntry *before = NULL;
+
+    while( root != NULL )
+    {
+        if( compareMmuKey( root, procID, segment, address ) <= 0 )
+        {
+            before = root;
+            root = root->right;
+        }
+        else
+        {
+            root = root->left;
+        }
+    }
+
+    return before;
+}
+
+/*
+Function name: compareMmuKey
+Algorithm: Orders keys by PID, then segment, then base
+Precondition: Given an entry, PID, memory segment, and memory base
+Postcondition: Returns a negative value, zero, or a positive value as the
+               entry's key is below, equal to, or above the given one
+Exceptions: None
+Note: None
+*/
+int compareMmuKey( MmuEntry *entry, int procID, int segment, int base )
+{
+    if( entry->PID != procID )
+    {
+        return entry->PID < procID ? -1 : 1;
+    }
+
+    if( entry->segment != segment )
+    {
+        return entry->segment < segment ? -1 : 1;
+    }
+
+    if( entry->base != base )
+    {
+        return entry->base < base ? -1 : 1;
+    }
+
+    return 0;
+}
@@ -18,27 +18,53 @@ Note: None
 
 #include "StringUtils.h"
 
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define MMU_INITIAL_BUCKETS 64
+
 // Data Structure Definitions (structs, enums, etc.)//////////////////////////
 
-typedef struct MMU
+typedef struct MmuEntry
 {
     int PID;
     int segment;
     int base;
     int offset;
-    struct MMU *next;
+    unsigned int priority;
+    struct MmuEntry *hashNext;
+    struct MmuEntry *left;
+    struct MmuEntry *right;
+} MmuEntry;
+
+typedef struct MMU
+{
+    MmuEntry **buckets;
+    int bucketCount;
+    int entryCount;
+    MmuEntry *ranges;
 } MMU;
 
-const int SEG_OFFSET;
-const int BASE_OFFSET;
+extern const int SEG_OFFSET;
+extern const int BASE_OFFSET;
 
 // Function Prototypes  ///////////////////////////////////////////////////////
 
 MMU *addMem(MMU *memory, int procID, int segment, int base, int offset);
-Boolean isValidAllocate(MMU *memory, int base, int offset);
+Boolean isValidAllocate(MMU *memory, int procID, int segment, int base,
+                                                                    int offset);
 Boolean isValidAccess(MMU *memory, int procID, int segment, int base,
                                                                     int offset);
 MMU *clearMMU( MMU *memory );
+int releaseMem( MMU *memory, int procID );
+MMU *createMMU( void );
+unsigned int hashMmuKey( int procID, int segment, int base );
+MmuEntry *findMmuEntry( MMU *memory, int procID, int segment, int base );
+void growMmuBuckets( MMU *memory );
+MmuEntry *insertMmuRange( MmuEntry *root, MmuEntry *entry );
+MmuEntry *removeMmuRange( MmuEntry *root, MmuEntry *entry );
+MmuEntry *findMmuRangeBefore( MmuEntry *root, int procID, int segment,
+                                                                int address );
+int compareMmuKey( MmuEntry *entry, int procID, int segment, int base );
 
 // Terminating Precompiler Directives ////////////////////////////////////////
 #endif // MMU_H
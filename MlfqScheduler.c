@@ -0,0 +1,358 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: MlfqScheduler.c
+Brief: Implementation file for multi-level feedback queue scheduling code
+Details: Implements the MLFQ-P policy; every priority level keeps its READY
+         processes in a FIFO ring, a process that uses up the quantum of its
+         level drops one level, and a periodic boost returns every process
+         to the top level; the boost period and the statistics are shared
+         by the schedulers of every core
+Version: 1.0
+         17 October 2026
+         Initial development of MlfqScheduler code
+Note: None
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "MlfqScheduler.h"
+
+/*
+Function name: createMlfqPolicy
+Algorithm: Builds one ring per level and sets the MLFQ hooks of the
+           scheduler; the levels and their quanta come from the config, or,
+           when none are configured, MLFQ_DEFAULT_LEVELS levels starting at
+           the config quantum and doubling at each lower level; the boost
+           period and statistics are taken from shareWith, or built here
+Precondition: Given scheduler, simulator config, number of processes, and
+              MLFQ scheduler of another core, or NULL
+Postcondition: Scheduler runs the MLFQ-P policy with all levels empty
+Exceptions: None
+Note: A pcb carries the boost epoch it was last placed in, so every core
+      must count boosts from the same epoch for a pcb that moves
+*/
+void createMlfqPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)malloc( sizeof( MlfqPolicy ) );
+    MlfqShare *share;
+    int level;
+
+    policy->levels = configDataPtr->mlfqLevels;
+
+    for( level = 0; level < MLFQ_MAX_LEVELS; level++ )
+    {
+        if( configDataPtr->mlfqLevels > 0 )
+        {
+            policy->quanta[ level ] = configDataPtr->mlfqQuanta[ level ];
+        }
+        else if( level == 0 )
+        {
+            policy->levels = MLFQ_DEFAULT_LEVELS;
+            policy->quanta[ level ] = configDataPtr->quantumCycles;
+
+            if( policy->quanta[ level ] < 1 )
+            {
+                policy->quanta[ level ] = 1;
+            }
+        }
+        else
+        {
+            policy->quanta[ level ] = 2 * policy->quanta[ level - 1 ];
+        }
+
+        policy->queues[ level ] = NULL;
+    }
+
+    for( level = 0; level < policy->levels; level++ )
+    {
+        policy->queues[ level ] = createPcbRing( pcbCount );
+    }
+
+    if( shareWith != NULL )
+    {
+        share = (MlfqShare *)shareWith->sharedData;
+    }
+    else
+    {
+        share = (MlfqShare *)malloc( sizeof( MlfqShare ) );
+        pthread_mutex_init( &share->shareLock, NULL );
+        share->boostCycles = configDataPtr->mlfqBoostCycles;
+        share->cyclesSinceBoost = 0;
+        share->epoch = 0;
+        share->demotions = 0;
+        share->boosts = 0;
+
+        for( level = 0; level < MLFQ_MAX_LEVELS; level++ )
+        {
+            share->dispatchCount[ level ] = 0;
+            share->cyclesRun[ level ] = 0;
+        }
+
+        scheduler->ownsShared = True;
+    }
+
+    policy->liftedEpoch = share->epoch;
+    policy->share = share;
+
+    scheduler->policyData = policy;
+    scheduler->sharedData = share;
+    scheduler->preemptive = True;
+    scheduler->enqueue = mlfqEnqueue;
+    scheduler->onWake = mlfqEnqueue;
+    scheduler->pickNext = mlfqPickNext;
+    scheduler->quantum = mlfqQuantum;
+    scheduler->onTick = mlfqTick;
+    scheduler->report = mlfqReport;
+    scheduler->clearPolicy = clearMlfqPolicy;
+}
+
+/*
+Function name: mlfqEnqueue
+Algorithm: Lifts the rings of the core past any boost it has not seen,
+           then appends the pcb to the ring of its level
+Precondition: Given MLFQ scheduler and a READY pcb in no ring
+Postcondition: Pcb is last in line at its level
+Exceptions: None
+Note: O(1); a pcb returning from I/O keeps its level and the cycles it
+      has used there, so giving up the CPU early does not reset them
+*/
+void mlfqEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+
+    pthread_mutex_lock( &policy->share->shareLock );
+    liftMlfqQueues( policy );
+    refreshMlfqLevel( policy, pcb );
+    pthread_mutex_unlock( &policy->share->shareLock );
+
+    pushPcbRing( policy->queues[ pcb->schedLevel ], pcb );
+}
+
+/*
+Function name: mlfqPickNext
+Algorithm: Lifts the rings of the core past any boost it has not seen,
+           then pops the head of the highest priority level that is not
+           empty
+Precondition: Given MLFQ scheduler
+Postcondition: Returns pcb to run, or NULL if none is READY; the dispatch
+               is counted against its level
+Exceptions: None
+Note: O(1); at most MLFQ_MAX_LEVELS rings are looked at
+*/
+PcbType *mlfqPickNext( Scheduler *scheduler )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+    PcbType *pcb = NULL;
+    int level;
+
+    pthread_mutex_lock( &policy->share->shareLock );
+    liftMlfqQueues( policy );
+
+    for( level = 0; level < policy->levels && pcb == NULL; level++ )
+    {
+        pcb = popPcbRing( policy->queues[ level ] );
+
+        if( pcb != NULL )
+        {
+            refreshMlfqLevel( policy, pcb );
+            policy->share->dispatchCount[ pcb->schedLevel ]++;
+        }
+    }
+
+    pthread_mutex_unlock( &policy->share->shareLock );
+
+    return pcb;
+}
+
+/*
+Function name: mlfqQuantum
+Algorithm: Returns what is left of the quantum of the pcb's level
+Precondition: Given MLFQ scheduler and the pcb being dispatched
+Postcondition: Returns number of cycles the pcb may run before preemption
+Exceptions: None
+Note: None
+*/
+int mlfqQuantum( Scheduler *scheduler, PcbType *pcb )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+
+    return policy->quanta[ pcb->schedLevel ] - pcb->levelCycles;
+}
+
+/*
+Function name: mlfqTick
+Algorithm: Charges the cycles to the pcb and its level; a pcb that has
+           used the whole quantum of its level drops one level, or starts a
+           fresh quantum at the lowest level; once the boost period has
+           passed every process is boosted to the top level
+Precondition: Given MLFQ scheduler, running pcb, and cycles it just ran
+Postcondition: Level of the pcb and the boost period are brought up to date
+Exceptions: None
+Note: A boost period of zero turns boosting off; the period counts the
+      cycles run on every core
+*/
+void mlfqTick( Scheduler *scheduler, PcbType *pcb, int cycles )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+    MlfqShare *share = policy->share;
+
+    pthread_mutex_lock( &share->shareLock );
+    share->cyclesRun[ pcb->schedLevel ] += cycles;
+    pcb->levelCycles += cycles;
+
+    if( pcb->levelCycles >= policy->quanta[ pcb->schedLevel ] )
+    {
+        if( pcb->schedLevel < policy->levels - 1 )
+        {
+            pcb->schedLevel++;
+            share->demotions++;
+        }
+
+        pcb->levelCycles = 0;
+    }
+
+    if( share->boostCycles > 0 )
+    {
+        share->cyclesSinceBoost += cycles;
+
+        if( share->cyclesSinceBoost >= share->boostCycles )
+        {
+            boostMlfq( share );
+            liftMlfqQueues( policy );
+            refreshMlfqLevel( policy, pcb );
+        }
+    }
+
+    pthread_mutex_unlock( &share->shareLock );
+}
+
+/*
+Function name: mlfqReport
+Algorithm: Logs the quantum, dispatches, and cycles run of every level,
+           then the number of demotions and boosts
+Precondition: Given MLFQ scheduler, config, and output log
+Postcondition: Per-level statistics are displayed and/or stored in the log
+Exceptions: None
+Note: The statistics cover every core that shares them
+*/
+void mlfqReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+    MlfqShare *share = policy->share;
+    char displayString[ MAX_STR_LEN ];
+    int level;
+
+    for( level = 0; level < policy->levels; level++ )
+    {
+        sprintf( displayString,
+            "OS: MLFQ level %d, %d cycle quantum, %d dispatches, "
+                                                    "%ld cycles run\n",
+            level, policy->quanta[ level ], share->dispatchCount[ level ],
+                                                share->cyclesRun[ level ] );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+    }
+
+    sprintf( displayString, "OS: MLFQ %d demotions, %d boosts\n",
+                                        share->demotions, share->boosts );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+}
+
+/*
+Function name: clearMlfqPolicy
+Algorithm: Frees the ring of every level, the shared boost period and
+           statistics if this scheduler built them, then the policy
+Precondition: Given MLFQ scheduler
+Postcondition: Policy memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearMlfqPolicy( Scheduler *scheduler )
+{
+    MlfqPolicy *policy = (MlfqPolicy *)scheduler->policyData;
+    int level;
+
+    for( level = 0; level < policy->levels; level++ )
+    {
+        policy->queues[ level ] = clearPcbRing( policy->queues[ level ] );
+    }
+
+    if( scheduler->ownsShared == True )
+    {
+        pthread_mutex_destroy( &policy->share->shareLock );
+        free( policy->share );
+    }
+
+    free( policy );
+    scheduler->policyData = NULL;
+    scheduler->sharedData = NULL;
+}
+
+/*
+Function name: refreshMlfqLevel
+Algorithm: Moves a pcb last placed before the latest boost to the top level
+           with a fresh quantum
+Precondition: Given MLFQ policy with its shared lock held, and a pcb
+Postcondition: Pcb level reflects every boost so far
+Exceptions: None
+Note: Lets a boost reach BLOCKED and RUNNING pcbs, and pcbs on other
+      cores, without visiting them
+*/
+void refreshMlfqLevel( MlfqPolicy *policy, PcbType *pcb )
+{
+    if( pcb->levelEpoch != policy->share->epoch )
+    {
+        pcb->schedLevel = 0;
+        pcb->levelCycles = 0;
+        pcb->levelEpoch = policy->share->epoch;
+    }
+}
+
+/*
+Function name: boostMlfq
+Algorithm: Starts a new boost epoch and restarts the boost period
+Precondition: Given shared MLFQ state with its lock held
+Postcondition: Every pcb placed before now is due back at the top level
+Exceptions: None
+Note: Each core lifts its own READY pcbs the next time it touches them
+*/
+void boostMlfq( MlfqShare *share )
+{
+    share->epoch++;
+    share->boosts++;
+    share->cyclesSinceBoost = 0;
+}
+
+/*
+Function name: liftMlfqQueues
+Algorithm: If a boost has started since this core last looked, moves every
+           READY pcb below the top level to the end of the top level ring
+Precondition: Given MLFQ policy with its shared lock held
+Postcondition: All READY pcbs of this core are at the top level; the others
+               are moved when next enqueued or picked
+Exceptions: None
+Note: None
+*/
+void liftMlfqQueues( MlfqPolicy *policy )
+{
+    PcbType *pcb;
+    int level;
+
+    if( policy->liftedEpoch == policy->share->epoch )
+    {
+        return;
+    }
+
+    policy->liftedEpoch = policy->share->epoch;
+
+    for( level = 1; level < policy->levels; level++ )
+    {
+        while( ( pcb = popPcbRing( policy->queues[ level ] ) ) != NULL )
+        {
+            refreshMlfqLevel( policy, pcb );
+            pushPcbRing( policy->queues[ 0 ], pcb );
+        }
+    }
+}
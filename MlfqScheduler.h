@@ -0,0 +1,64 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: MlfqScheduler.h
+Brief: Header file for multi-level feedback queue scheduling code
+Details: Specifies functions, constants, and other information
+         related to multi-level feedback queue scheduling code
+Version: 1.0
+         17 October 2026
+         Initial development of MlfqScheduler code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef MLFQ_SCHEDULER_H
+#define MLFQ_SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "Scheduler.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define MLFQ_DEFAULT_LEVELS 3
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct MlfqShare
+{
+    pthread_mutex_t shareLock;
+    int boostCycles;
+    int cyclesSinceBoost;
+    int epoch;
+    int dispatchCount[ MLFQ_MAX_LEVELS ];
+    long cyclesRun[ MLFQ_MAX_LEVELS ];
+    int demotions;
+    int boosts;
+} MlfqShare;
+
+typedef struct MlfqPolicy
+{
+    int levels;
+    int quanta[ MLFQ_MAX_LEVELS ];
+    PcbRing *queues[ MLFQ_MAX_LEVELS ];
+    int liftedEpoch;
+    MlfqShare *share;
+} MlfqPolicy;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void createMlfqPolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith );
+void mlfqEnqueue( Scheduler *scheduler, PcbType *pcb );
+PcbType *mlfqPickNext( Scheduler *scheduler );
+int mlfqQuantum( Scheduler *scheduler, PcbType *pcb );
+void mlfqTick( Scheduler *scheduler, PcbType *pcb, int cycles );
+void mlfqReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog );
+void clearMlfqPolicy( Scheduler *scheduler );
+void refreshMlfqLevel( MlfqPolicy *policy, PcbType *pcb );
+void boostMlfq( MlfqShare *share );
+void liftMlfqQueues( MlfqPolicy *policy );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // MLFQ_SCHEDULER_H
@@ -0,0 +1,642 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: MultiCore.c
+Brief: Implementation file for multi-core simulator code
+Details: Implements all functions of the multi-core simulator; every
+         simulated core runs on its own host thread with its own ready
+         queue of the scheduling policy, and an idle core steals READY
+         processes from busy ones
+Version: 1.0
+         17 October 2026
+         Initial development of MultiCore code
+Note: Runs on the real-time clock only, with all I/O asynchronous
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "MultiCore.h"
+
+/*
+Function name: runMultiCore
+Algorithm: Hands the processes out round-robin to the home queues of the
+           configured number of cores, starts one thread per core, waits
+           for every process to exit, then reports the work of each core
+           and, once for the system, the scheduling policy
+Precondition: Given config with more than one core, output log, started
+              device manager, pcb queue with all processes READY, and the
+              PID table of the queue
+Postcondition: All processes have been run to EXIT and the per-core
+               dispatch, steal, and busy time figures are logged
+Exceptions: None
+Note: The pcb queue is never reordered, so a pcb keeps its address while
+      it moves between ready queues
+*/
+void runMultiCore( ConfigDataType *configDataPtr, OutputType *outputLog,
+                DeviceManager *devices, PcbType *pcbQueue, PcbTable *pcbTable )
+{
+    MultiCoreType system;
+    PcbType *currentPcb;
+    int coreIndex, pcbCount = 0;
+    char displayString[ STD_STR_LEN ];
+
+    system.configDataPtr = configDataPtr;
+    system.outputLog = outputLog;
+    system.devices = devices;
+    system.pcbTable = pcbTable;
+    system.memory = NULL;
+    system.memRemaining = findMemoryCapacity( configDataPtr );
+    system.paging = NULL;
+
+    if( configDataPtr->pagingCode != PAGING_OFF_CODE )
+    {
+        system.paging = createPaging( configDataPtr, pcbTable->size );
+    }
+    system.completionWaiter = False;
+    system.coreCount = configDataPtr->cpuCores;
+    system.cores = (CoreType *)malloc( system.coreCount * sizeof( CoreType ) );
+    pthread_mutex_init( &system.systemLock, NULL );
+    pthread_cond_init( &system.workAvailable, NULL );
+    atomic_init( &system.readyCount, 0 );
+
+    for( coreIndex = 0; coreIndex < system.coreCount; coreIndex++ )
+    {
+        system.cores[ coreIndex ].coreID = coreIndex;
+        system.cores[ coreIndex ].scheduler = createScheduler( configDataPtr,
+                        pcbTable->size, coreIndex == 0 ? NULL
+                                            : system.cores[ 0 ].scheduler );
+        system.cores[ coreIndex ].dispatchCount = 0;
+        system.cores[ coreIndex ].stealCount = 0;
+        system.cores[ coreIndex ].busyTime = 0;
+        system.cores[ coreIndex ].lastPcb = NULL;
+        initOverhead( &system.cores[ coreIndex ].overhead );
+        system.cores[ coreIndex ].system = &system;
+        pthread_mutex_init( &system.cores[ coreIndex ].queueLock, NULL );
+    }
+
+    for( currentPcb = pcbQueue; currentPcb != NULL;
+                                                currentPcb = currentPcb->next )
+    {
+        currentPcb->homeCore = pcbCount % system.coreCount;
+        pushReadyPcb( &system, currentPcb, False );
+        pcbCount++;
+    }
+
+    atomic_init( &system.activeCount, pcbCount );
+
+    for( coreIndex = 0; coreIndex < system.coreCount; coreIndex++ )
+    {
+        pthread_create( &system.cores[ coreIndex ].threadID, NULL, runCore,
+                                                &system.cores[ coreIndex ] );
+    }
+
+    for( coreIndex = 0; coreIndex < system.coreCount; coreIndex++ )
+    {
+        pthread_join( system.cores[ coreIndex ].threadID, NULL );
+    }
+
+    outputLine( configDataPtr, outputLog, "\n" );
+
+    for( coreIndex = 0; coreIndex < system.coreCount; coreIndex++ )
+    {
+        sprintf( displayString,
+            "OS: Core %d, %d dispatches, %d steals, %lld ms busy\n",
+            coreIndex, system.cores[ coreIndex ].dispatchCount,
+            system.cores[ coreIndex ].stealCount,
+            (long long)( system.cores[ coreIndex ].busyTime / NSEC_PER_MSEC ) );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+        reportOverhead( configDataPtr, outputLog,
+                                        &system.cores[ coreIndex ].overhead );
+    }
+
+    // every core shares the policy accounting, so it is reported once
+    system.cores[ 0 ].scheduler->report( system.cores[ 0 ].scheduler,
+                                                configDataPtr, outputLog );
+
+    for( coreIndex = 0; coreIndex < system.coreCount; coreIndex++ )
+    {
+        system.cores[ coreIndex ].scheduler =
+                        clearScheduler( system.cores[ coreIndex ].scheduler );
+        pthread_mutex_destroy( &system.cores[ coreIndex ].queueLock );
+    }
+
+    reportPaging( configDataPtr, outputLog, system.paging );
+    system.memory = clearMMU( system.memory );
+    system.paging = clearPaging( system.paging );
+    pthread_cond_destroy( &system.workAvailable );
+    pthread_mutex_destroy( &system.systemLock );
+    free( system.cores );
+}
+
+/*
+Function name: runCore
+Algorithm: Thread body of a simulated core; runs the next process from its
+           own ready queue, or one stolen from another core when its own
+           is empty; with no work anywhere it either waits for a device
+           completion, if no other core already is, or waits to be told
+           that work is available; repeats until every process has exited
+Precondition: Given pointer to an initialized core
+Postcondition: Returns once the system has no active processes left
+Exceptions: None
+Note: Exactly one idle core at a time waits on the device completions so
+      that each completion wakes a single core
+*/
+void *runCore( void *core )
+{
+    CoreType *thisCore = (CoreType *)core;
+    MultiCoreType *system = thisCore->system;
+    PcbType *currentPcb;
+    Boolean idleLogged = False;
+    char displayString[ STD_STR_LEN ];
+
+    while( True )
+    {
+        currentPcb = popReadyPcb( thisCore );
+
+        if( currentPcb == NULL )
+        {
+            currentPcb = stealReadyPcb( thisCore );
+        }
+
+        if( currentPcb != NULL )
+        {
+            idleLogged = False;
+            chargeOverhead( system->configDataPtr->decisionCost,
+                                        &thisCore->overhead.decisions );
+
+            if( currentPcb != thisCore->lastPcb )
+            {
+                chargeOverhead( system->configDataPtr->switchCost,
+                                        &thisCore->overhead.contextSwitches );
+                thisCore->lastPcb = currentPcb;
+            }
+
+            runCoreSlice( thisCore, currentPcb );
+            continue;
+        }
+
+        if( deliverCoreCompletions( thisCore, NULL ) > 0 )
+        {
+            continue;
+        }
+
+        pthread_mutex_lock( &system->systemLock );
+
+        if( atomic_load( &system->activeCount ) == 0 )
+        {
+            pthread_mutex_unlock( &system->systemLock );
+            break;
+        }
+
+        if( atomic_load( &system->readyCount ) > 0 )
+        {
+            pthread_mutex_unlock( &system->systemLock );
+            continue;
+        }
+
+        if( idleLogged == False )
+        {
+            sprintf( displayString, "OS: Core %d idle\n", thisCore->coreID );
+            outputEvent( system->configDataPtr, system->outputLog,
+                                    accessClock( LAP_TIMER ), displayString );
+            idleLogged = True;
+        }
+
+        if( system->completionWaiter == False )
+        {
+            system->completionWaiter = True;
+            pthread_mutex_unlock( &system->systemLock );
+
+            awaitDeviceCompletion( system->devices );
+            deliverCoreCompletions( thisCore, NULL );
+
+            pthread_mutex_lock( &system->systemLock );
+            system->completionWaiter = False;
+            pthread_cond_broadcast( &system->workAvailable );
+        }
+        else
+        {
+            pthread_cond_wait( &system->workAvailable, &system->systemLock );
+        }
+
+        pthread_mutex_unlock( &system->systemLock );
+    }
+
+    return NULL;
+}
+
+/*
+Function name: runCoreSlice
+Algorithm: Runs the given process on the core until its quantum expires,
+           its run operation ends, or, for a preemptive policy, another
+           process is interrupted back to this core; an I/O operation
+           blocks the process on its device and ends the slice; a
+           non-preemptive policy runs the process until it blocks or ends
+Precondition: Given core and a READY process taken from a ready queue
+Postcondition: Process is BLOCKED on a device, back in its home ready queue,
+               or in EXIT state; the core's dispatch and busy figures are
+               updated
+Exceptions: None
+Note: Cycles run in steps that end where a device completion is due, and
+      completions are delivered at the end of every step
+*/
+void runCoreSlice( CoreType *core, PcbType *currentPcb )
+{
+    MultiCoreType *system = core->system;
+    ConfigDataType *configDataPtr = system->configDataPtr;
+    OpCodeType *currentOpCode;
+    DeviceRequest *ioRequest;
+    SimTime sliceStart, faultEnd;
+    Boolean opStarted = False;
+    int quantum, cycles, stallTime;
+    char *ioType;
+    char displayString[ STD_STR_LEN ];
+
+    pthread_mutex_lock( &core->queueLock );
+    quantum = core->scheduler->quantum( core->scheduler, currentPcb );
+    pthread_mutex_unlock( &core->queueLock );
+    sliceStart = accessClock( LAP_TIMER );
+    core->dispatchCount++;
+
+    sprintf( displayString,
+        "OS: Process %d selected on core %d with %d ms remaining\n",
+        currentPcb->PID, core->coreID, currentPcb->timeRemaining );
+    coreEvent( system, displayString );
+
+    currentPcb->state = RUNNING;
+    sprintf( displayString, "OS: Process %d set in RUNNING state\n\n",
+                                                            currentPcb->PID );
+    coreEvent( system, displayString );
+
+    while( currentPcb->state == RUNNING && currentPcb->programCounter != NULL
+        && quantum > 0 && ( currentPcb->timeRemaining > 0
+                                || core->scheduler->preemptive == False ) )
+    {
+        currentOpCode = currentPcb->programCounter;
+
+        if( currentOpCode->opLtr == 'O' || currentOpCode->opLtr == 'I' )
+        {
+            if( currentOpCode->opLtr == 'I' )
+            {
+                ioType = "input";
+            }
+            else
+            {
+                ioType = "output";
+            }
+
+            sprintf( displayString, "Process: %d, %s %s start\n\n",
+                        currentPcb->PID, currentOpCode->opName, ioType );
+            coreEvent( system, displayString );
+
+            ioRequest = (DeviceRequest *)malloc( sizeof( DeviceRequest ) );
+            ioRequest->PID = currentPcb->PID;
+            ioRequest->milliSeconds = configDataPtr->ioCycleRate
+                                                    * currentOpCode->opValue;
+            ioRequest->isAsync = True;
+            ioRequest->endingTime = accessClock( LAP_TIMER )
+                                    + msecToSimTime( ioRequest->milliSeconds );
+            ioRequest->opType = ioType;
+            ioRequest->opName = currentOpCode->opName;
+
+            currentPcb->timeRemaining -= ioRequest->milliSeconds;
+            currentPcb->programCounter = currentPcb->programCounter->next;
+            currentPcb->state = BLOCKED;
+
+            sprintf( displayString, "OS: Process %d set in BLOCKED state\n",
+                                                            currentPcb->PID );
+            coreEvent( system, displayString );
+
+            pthread_mutex_lock( &core->queueLock );
+            core->scheduler->onBlock( core->scheduler, currentPcb );
+            pthread_mutex_unlock( &core->queueLock );
+
+            submitDeviceOp( system->devices,
+                                getDeviceClass( currentOpCode ), ioRequest );
+        }
+        else if( currentOpCode->opLtr == 'P' )
+        {
+            if( opStarted == False )
+            {
+                sprintf( displayString, "Process: %d, %s operation start\n",
+                                currentPcb->PID, currentOpCode->opName );
+                coreEvent( system, displayString );
+                opStarted = True;
+            }
+
+            cycles = countRunCycles( configDataPtr, system->devices, NULL,
+                    accessClock( LAP_TIMER ), quantum, currentOpCode->opValue );
+            runClock( configDataPtr->procCycleRate * cycles );
+            currentOpCode->opValue -= cycles;
+            currentPcb->timeRemaining -= configDataPtr->procCycleRate * cycles;
+            quantum -= cycles;
+
+            pthread_mutex_lock( &core->queueLock );
+            core->scheduler->onTick( core->scheduler, currentPcb, cycles );
+            pthread_mutex_unlock( &core->queueLock );
+
+            if( currentOpCode->opValue == 0 )
+            {
+                currentPcb->programCounter = currentPcb->programCounter->next;
+                opStarted = False;
+
+                sprintf( displayString, "Process: %d, %s operation end\n\n",
+                                currentPcb->PID, currentOpCode->opName );
+                coreEvent( system, displayString );
+
+                if( core->scheduler->preemptive == True )
+                {
+                    break;
+                }
+            }
+
+            if( deliverCoreCompletions( core, currentPcb ) > 0
+                                    && core->scheduler->preemptive == True )
+            {
+                break;
+            }
+        }
+        else if( currentOpCode->opLtr == 'M' )
+        {
+            pthread_mutex_lock( &system->systemLock );
+
+            if( simulateMemoryOp( configDataPtr, system->outputLog,
+                            &system->memory, &system->memRemaining,
+                            system->paging, currentPcb->PID, currentOpCode,
+                                            &stallTime, &faultEnd ) == True )
+            {
+                currentPcb->programCounter = currentPcb->programCounter->next;
+            }
+            else
+            {
+                currentPcb->state = EXIT;
+            }
+
+            pthread_mutex_unlock( &system->systemLock );
+
+            // only this core stalls on its TLB miss, so no lock is held
+            if( stallTime > 0 )
+            {
+                runClock( stallTime );
+            }
+
+            if( faultEnd > 0 )
+            {
+                sprintf( displayString, "Process: %d, swap page-in start\n\n",
+                                                            currentPcb->PID );
+                coreEvent( system, displayString );
+
+                ioRequest = (DeviceRequest *)malloc( sizeof( DeviceRequest ) );
+                ioRequest->PID = currentPcb->PID;
+                ioRequest->milliSeconds = (int)( ( faultEnd
+                                - accessClock( LAP_TIMER ) ) / NSEC_PER_MSEC );
+                ioRequest->isAsync = True;
+                ioRequest->endingTime = faultEnd;
+                ioRequest->opType = "page-in";
+                ioRequest->opName = "swap";
+                currentPcb->state = BLOCKED;
+
+                sprintf( displayString, "OS: Process %d set in BLOCKED state\n",
+                                                            currentPcb->PID );
+                coreEvent( system, displayString );
+
+                pthread_mutex_lock( &core->queueLock );
+                core->scheduler->onBlock( core->scheduler, currentPcb );
+                pthread_mutex_unlock( &core->queueLock );
+
+                submitDeviceOp( system->devices, SWAP_DEVICE, ioRequest );
+            }
+        }
+        else if( currentOpCode->opLtr == 'A' )
+        {
+            currentPcb->state = EXIT;
+        }
+    }
+
+    core->busyTime += accessClock( LAP_TIMER ) - sliceStart;
+
+    if( currentPcb->state == BLOCKED )
+    {
+        return;
+    }
+
+    if( currentPcb->state == EXIT || currentPcb->timeRemaining <= 0 )
+    {
+        currentPcb->state = EXIT;
+
+        pthread_mutex_lock( &core->queueLock );
+        core->scheduler->onExit( core->scheduler, currentPcb );
+        pthread_mutex_unlock( &core->queueLock );
+
+        pthread_mutex_lock( &system->systemLock );
+
+        // other processes may still hold memory, so only this one's is freed
+        if( core->scheduler->preemptive == False )
+        {
+            system->memRemaining += releaseMem( system->memory,
+                                                            currentPcb->PID );
+        }
+
+        if( system->paging != NULL )
+        {
+            releasePages( system->paging, currentPcb->PID );
+        }
+
+        pthread_mutex_unlock( &system->systemLock );
+
+        sprintf( displayString,
+            "OS: Process %d ended on core %d and set in EXIT state\n",
+            currentPcb->PID, core->coreID );
+        coreEvent( system, displayString );
+
+        if( atomic_fetch_sub( &system->activeCount, 1 ) == 1 )
+        {
+            pthread_mutex_lock( &system->systemLock );
+            pthread_cond_broadcast( &system->workAvailable );
+            pthread_mutex_unlock( &system->systemLock );
+            wakeDeviceCompletionWaiter( system->devices );
+        }
+    }
+    else
+    {
+        currentPcb->state = READY;
+        sprintf( displayString, "OS: Process %d set in READY state\n",
+                                                            currentPcb->PID );
+        coreEvent( system, displayString );
+        pushReadyPcb( system, currentPcb, False );
+    }
+}
+
+/*
+Function name: pushReadyPcb
+Algorithm: Hands the process to the scheduling policy of its home core,
+           as woken from I/O or as returned from a slice, counts it as
+           ready, and wakes any core waiting for work
+Precondition: Given system, a READY process that is in no ready queue, and
+              whether it was just woken from I/O
+Postcondition: Process can be picked by its home core's scheduler
+Exceptions: None
+Note: The ready count rises before the wakeup is sent under the system
+      lock, so an idle core cannot miss it
+*/
+void pushReadyPcb( MultiCoreType *system, PcbType *pcb, Boolean woken )
+{
+    CoreType *home = &system->cores[ pcb->homeCore ];
+
+    pthread_mutex_lock( &home->queueLock );
+
+    if( woken == True )
+    {
+        home->scheduler->onWake( home->scheduler, pcb );
+    }
+    else
+    {
+        home->scheduler->enqueue( home->scheduler, pcb );
+    }
+
+    pthread_mutex_unlock( &home->queueLock );
+
+    atomic_fetch_add( &system->readyCount, 1 );
+
+    pthread_mutex_lock( &system->systemLock );
+    pthread_cond_broadcast( &system->workAvailable );
+    pthread_mutex_unlock( &system->systemLock );
+}
+
+/*
+Function name: popReadyPcb
+Algorithm: Asks the scheduling policy of the core for the process it would
+           run next
+Precondition: Given core
+Postcondition: Returns the removed process, or NULL if the core had no
+               READY process
+Exceptions: None
+Note: None
+*/
+PcbType *popReadyPcb( CoreType *core )
+{
+    PcbType *selected;
+
+    pthread_mutex_lock( &core->queueLock );
+    selected = core->scheduler->pickNext( core->scheduler );
+    pthread_mutex_unlock( &core->queueLock );
+
+    if( selected != NULL )
+    {
+        atomic_fetch_sub( &core->system->readyCount, 1 );
+    }
+
+    return selected;
+}
+
+/*
+Function name: stealReadyPcb
+Algorithm: Visits the other cores in order, starting after the thief, and
+           takes the process the first core with ready work would have run
+           next; the stolen process moves its home to the thief, whose
+           policy is told it has arrived
+Precondition: Given idle core
+Postcondition: Returns the stolen process, or NULL if no core had ready work
+Exceptions: None
+Note: None
+*/
+PcbType *stealReadyPcb( CoreType *thief )
+{
+    MultiCoreType *system = thief->system;
+    PcbType *stolen;
+    int offset;
+
+    for( offset = 1; offset < system->coreCount; offset++ )
+    {
+        stolen = popReadyPcb( &system->cores[ ( thief->coreID + offset )
+                                                    % system->coreCount ] );
+        if( stolen != NULL )
+        {
+            stolen->homeCore = thief->coreID;
+            thief->stealCount++;
+
+            pthread_mutex_lock( &thief->queueLock );
+            thief->scheduler->onMigrate( thief->scheduler, stolen );
+            pthread_mutex_unlock( &thief->queueLock );
+
+            return stolen;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+Function name: deliverCoreCompletions
+Algorithm: Takes every I/O completion posted by the device workers, logs
+           the interrupt for each, and returns each finished process to the
+           ready queue of its home core
+Precondition: Given core and the process it is running, or NULL if idle
+Postcondition: Returns the number of processes made READY on this core
+               that preempt the running process; the completed requests
+               are returned to OS
+Exceptions: None
+Note: Any core may deliver; each completion is taken by exactly one
+*/
+int deliverCoreCompletions( CoreType *core, PcbType *runningPcb )
+{
+    MultiCoreType *system = core->system;
+    DeviceRequest *request, *nextRequest;
+    PcbType *wokenPcb;
+    int deliveredHere = 0;
+    char displayString[ STD_STR_LEN ];
+
+    request = takeDeviceCompletions( system->devices );
+
+    while( request != NULL )
+    {
+        nextRequest = request->completionNext;
+
+        wokenPcb = lookupPcb( system->pcbTable, request->PID );
+        chargeOverhead( system->configDataPtr->interruptCost,
+                                        &core->overhead.interruptEntries );
+
+        sprintf( displayString,
+            "OS: Interrupt called by process %d on core %d\n",
+            request->PID, core->coreID );
+        coreEvent( system, displayString );
+
+        sprintf( displayString, "Process: %d, %s %s end\n",
+                            request->PID, request->opName, request->opType );
+        coreEvent( system, displayString );
+
+        wokenPcb->state = READY;
+        sprintf( displayString, "OS: Process %d set in READY state\n",
+                                                                request->PID );
+        coreEvent( system, displayString );
+
+        if( wokenPcb->homeCore == core->coreID && ( runningPcb == NULL
+            || core->scheduler->preempts( core->scheduler, runningPcb,
+                                                        wokenPcb ) == True ) )
+        {
+            deliveredHere++;
+        }
+
+        pushReadyPcb( system, wokenPcb, True );
+        free( request );
+        request = nextRequest;
+    }
+
+    return deliveredHere;
+}
+
+/*
+Function name: coreEvent
+Algorithm: Stamps the event with the current clock time and writes it to
+           the output log while holding the system lock
+Precondition: Given system and event text
+Postcondition: Event is displayed and/or stored in the output log
+Exceptions: None
+Note: Keeps the lines of different cores from interleaving
+*/
+void coreEvent( MultiCoreType *system, char *eventText )
+{
+    pthread_mutex_lock( &system->systemLock );
+    outputEvent( system->configDataPtr, system->outputLog,
+                                        accessClock( LAP_TIMER ), eventText );
+    pthread_mutex_unlock( &system->systemLock );
+}
@@ -0,0 +1,71 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: MultiCore.h
+Brief: Header file for multi-core simulator code
+Details: Specifies functions, constants, and other information
+         related to multi-core simulator code
+Version: 1.0
+         17 October 2026
+         Initial development of MultiCore code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef MULTI_CORE_H
+#define MULTI_CORE_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "Simulator.h"
+#include "Scheduler.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct CoreType
+{
+    int coreID;
+    pthread_t threadID;
+    pthread_mutex_t queueLock;
+    Scheduler *scheduler;
+    int dispatchCount;
+    int stealCount;
+    SimTime busyTime;
+    OverheadType overhead;
+    PcbType *lastPcb;
+    struct MultiCoreType *system;
+} CoreType;
+
+typedef struct MultiCoreType
+{
+    ConfigDataType *configDataPtr;
+    OutputType *outputLog;
+    DeviceManager *devices;
+    PcbTable *pcbTable;
+    MMU *memory;
+    int memRemaining;
+    PagingType *paging;
+    pthread_mutex_t systemLock;
+    pthread_cond_t workAvailable;
+    atomic_int readyCount;
+    atomic_int activeCount;
+    Boolean completionWaiter;
+    int coreCount;
+    CoreType *cores;
+} MultiCoreType;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void runMultiCore( ConfigDataType *configDataPtr, OutputType *outputLog,
+                DeviceManager *devices, PcbType *pcbQueue, PcbTable *pcbTable );
+void *runCore( void *core );
+void runCoreSlice( CoreType *core, PcbType *currentPcb );
+void pushReadyPcb( MultiCoreType *system, PcbType *pcb, Boolean woken );
+PcbType *popReadyPcb( CoreType *core );
+PcbType *stealReadyPcb( CoreType *thief );
+int deliverCoreCompletions( CoreType *core, PcbType *runningPcb );
+void coreEvent( MultiCoreType *system, char *eventText );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // MULTI_CORE_H
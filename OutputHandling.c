@@ -12,6 +12,59 @@ Note:
 // Header Files ///////////////////////////////////////////////////
 #include "OutputHandling.h"
 
+/*
+Function name: createOutputLog
+Algorithm: Allocates the head node of an empty output log
+Precondition: None
+Postcondition: Returns head node with no lines after it
+Exceptions: None
+Note: The head holds no line; it keeps the last node so lines are
+      appended without walking the log
+*/
+OutputType *createOutputLog( void )
+{
+    OutputType *outputLog = (OutputType *)malloc( sizeof( OutputType ) );
+
+    outputLog->next = NULL;
+    outputLog->last = outputLog;
+
+    return outputLog;
+}
+
+/*
+Function name: appendOutputNode
+Algorithm: Adds a node holding the text after the last node of the log and
+           records it as the new last node; text too long for the node is
+           cut short, keeping its line end
+Precondition: Given output log head and line text
+Postcondition: Returns the new node, last in the log
+Exceptions: None
+Note: O(1)
+*/
+OutputType *appendOutputNode( OutputType *outputLog, char *text )
+{
+    OutputType *newLine = (OutputType *)malloc( sizeof( OutputType ) );
+    int textSize = (int)sizeof( newLine->text ), index = 0;
+
+    while( index < textSize - 1 && text[ index ] != NULL_CHAR )
+    {
+        newLine->text[ index ] = text[ index ];
+        index++;
+    }
+
+    if( text[ index ] != NULL_CHAR )
+    {
+        newLine->text[ index - 1 ] = '\n';
+    }
+
+    newLine->text[ index ] = NULL_CHAR;
+    newLine->next = NULL;
+    outputLog->last->next = newLine;
+    outputLog->last = newLine;
+
+    return newLine;
+}
+
 /*
 Function name: outputLine
 Algorithm: Checks os configuration to determine where output should be placed;
@@ -34,18 +87,63 @@ void outputLine( ConfigDataType *configDataPtr, OutputType *outputLog,
     if( configDataPtr->logToCode == LOGTO_FILE_CODE
         || configDataPtr->logToCode == LOGTO_BOTH_CODE )
     {
-        OutputType *currentLine = outputLog;
-        while( currentLine->next != NULL)
-        {
-            currentLine = currentLine->next;
-        }
-        currentLine->next = (OutputType *)malloc( sizeof( OutputType ) );
-        currentLine = currentLine->next;
-        copyString( currentLine->text, outputLine );
-        currentLine->next = NULL;
+        OutputType *currentLine = appendOutputNode( outputLog, outputLine );
+        currentLine->isEvent = False;
+    }
+}
+
+/*
+Function name: outputEvent
+Algorithm: Checks os configuration to determine where output should be placed;
+            for monitor or both, formats the event time and displays the
+            line to the screen;
+            for file or both, adds node holding the event time and text to
+            outputLog linked list, leaving the time unformatted until the
+            log is written
+Precondition: Given config, an output log pointer, an event time, and
+              the event text without its time stamp
+Postcondition: For monitor or both, displays time stamped line to the screen;
+               for file or both, adds node to outputLog linked list
+Exceptions: None
+Note: None
+*/
+void outputEvent( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                            SimTime time, char *eventText )
+{
+    char displayString[ MAX_STR_LEN ];
+
+    if( configDataPtr->logToCode == LOGTO_MONITOR_CODE
+        || configDataPtr->logToCode == LOGTO_BOTH_CODE )
+    {
+        eventToString( time, eventText, displayString );
+        printf( "%s", displayString );
+    }
+    if( configDataPtr->logToCode == LOGTO_FILE_CODE
+        || configDataPtr->logToCode == LOGTO_BOTH_CODE )
+    {
+        OutputType *currentLine = appendOutputNode( outputLog, eventText );
+        currentLine->isEvent = True;
+        currentLine->time = time;
     }
 }
 
+/*
+Function name: eventToString
+Algorithm: Formats an event time and prefixes it to the event text
+Precondition: Given an event time, the event text, and an output string
+              with room for the time stamped line
+Postcondition: Output string holds the time stamped line
+Exceptions: None
+Note: None
+*/
+void eventToString( SimTime time, char *eventText, char *outString )
+{
+    char timeStr[ STD_STR_LEN ];
+
+    simTimeToString( time, timeStr );
+    sprintf( outString, " %s, %s", timeStr, eventText );
+}
+
 /*
 Function name: writeOutputLogToFile
 Algorithm: If file or both is specied in OS simulator configuration,
@@ -67,7 +165,7 @@ int writeOutputLogToFile( ConfigDataType *configDataPtr,
         const char WRITE_ONLY_FLAG[] = "w";
         FILE *fileAccessPtr;
         OutputType *currentLine;
-        char codeString[ STD_STR_LEN ];
+        char codeString[ STD_STR_LEN ], lineString[ MAX_STR_LEN ];
 
         fileAccessPtr = fopen( configDataPtr->logToFileName, WRITE_ONLY_FLAG );
         if( fileAccessPtr == NULL )
@@ -90,13 +188,88 @@ int writeOutputLogToFile( ConfigDataType *configDataPtr,
                                                 configDataPtr->memAvailable );
         fprintf( fileAccessPtr, "Processor Cycle Rate (ms/cycle) : %d\n",
                                                 configDataPtr->procCycleRate );
-        fprintf( fileAccessPtr, "I/O Cycle Rate (ms/cycle)       : %d\n\n",
+        fprintf( fileAccessPtr, "I/O Cycle Rate (ms/cycle)       : %d\n",
                                                 configDataPtr->ioCycleRate );
+        configCodeToString( configDataPtr->clockModeCode, codeString );
+        fprintf( fileAccessPtr, "Clock Mode                      : %s\n",
+                                                                codeString );
+        fprintf( fileAccessPtr, "CPU Cores                       : %d\n",
+                                                    configDataPtr->cpuCores );
+
+        if( configDataPtr->switchCost > 0 || configDataPtr->decisionCost > 0
+                                        || configDataPtr->interruptCost > 0 )
+        {
+            fprintf( fileAccessPtr, "Context Switch Cost (ms)        : %d\n",
+                                                configDataPtr->switchCost );
+            fprintf( fileAccessPtr, "Scheduler Decision Cost (ms)    : %d\n",
+                                                configDataPtr->decisionCost );
+            fprintf( fileAccessPtr, "Interrupt Entry Cost (ms)       : %d\n",
+                                                configDataPtr->interruptCost );
+        }
+
+        if( configDataPtr->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE )
+        {
+            fprintf( fileAccessPtr, "MLFQ Boost Period (cycles)      : %d\n",
+                                            configDataPtr->mlfqBoostCycles );
+        }
+
+        if( configDataPtr->cpuSchedCode == CPU_SCHED_CFS_P_CODE )
+        {
+            fprintf( fileAccessPtr, "CFS Latency (cycles)            : %d\n",
+                                            configDataPtr->cfsLatencyCycles );
+        }
+
+        if( configDataPtr->cpuSchedCode == CPU_SCHED_LOTTERY_P_CODE )
+        {
+            fprintf( fileAccessPtr, "Lottery Seed                    : %d\n",
+                                                configDataPtr->lotterySeed );
+        }
+
+        if( configDataPtr->interruptQueueCode == INTERRUPT_QUEUE_WHEEL_CODE )
+        {
+            fprintf( fileAccessPtr, "Interrupt Queue                 : "
+                                                            "Timing wheel\n" );
+        }
+
+        if( configDataPtr->pagingCode != PAGING_OFF_CODE )
+        {
+            fprintf( fileAccessPtr, "Page Size                       : %d\n",
+                                                    configDataPtr->pageSize );
+            fprintf( fileAccessPtr, "TLB Entries                     : %d\n",
+                                                configDataPtr->tlbEntries );
+            fprintf( fileAccessPtr, "TLB Miss Cost (ms)              : %d\n",
+                                                configDataPtr->tlbMissCost );
+            fprintf( fileAccessPtr, "Page Walk Cost (ms)             : %d\n",
+                                                configDataPtr->pageWalkCost );
+        }
+
+        if( configDataPtr->pagingCode == PAGING_DEMAND_CODE )
+        {
+            configCodeToString( configDataPtr->pageReplacementCode,
+                                                                codeString );
+            fprintf( fileAccessPtr, "Page Replacement                : %s\n",
+                                                                codeString );
+            fprintf( fileAccessPtr, "Swap Time (ms)                  : %d\n",
+                                                    configDataPtr->swapTime );
+            fprintf( fileAccessPtr, "Swap Available (KB)             : %d\n",
+                                                configDataPtr->swapAvailable );
+        }
+
+        fprintf( fileAccessPtr, "\n" );
 
         currentLine = outputLog->next;
         while( currentLine != NULL )
         {
-            fprintf( fileAccessPtr, "%s", currentLine->text );
+            if( currentLine->isEvent == True )
+            {
+                eventToString( currentLine->time, currentLine->text,
+                                                                lineString );
+                fprintf( fileAccessPtr, "%s", lineString );
+            }
+            else
+            {
+                fprintf( fileAccessPtr, "%s", currentLine->text );
+            }
             currentLine = currentLine->next;
         }
 
@@ -107,23 +280,23 @@ int writeOutputLogToFile( ConfigDataType *configDataPtr,
 
 /*
 Function name: clearOutputLog
-Algorithm: Recusively calls itself through a output log linked list,
-           returns memeory to OS from the bottom of the list upward
+Algorithm: Walks the output log linked list from the head, returning each
+           node's memory to OS after stepping past it
 Precondition: Given output log, with or without data
 Postcondition: All node memory, if any, is returned to OS,
                return pointer (head) is set to null
 Exceptions: None
-Note: None
+Note: Iterative, so logs of millions of lines need no deep stack
 */
 OutputType *clearOutputLog( OutputType *outputLog )
 {
-    if( outputLog != NULL )
+    OutputType *nextLine;
+
+    while( outputLog != NULL )
     {
-        if( outputLog->next != NULL )
-        {
-            clearOutputLog( outputLog->next );
-        }
+        nextLine = outputLog->next;
         free( outputLog );
+        outputLog = nextLine;
     }
     return NULL;
 }
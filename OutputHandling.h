@@ -18,6 +18,7 @@ Note: None
 
 #include "ConfigAccess.h"
 #include "StringUtils.h"
+#include "SimClock.h"
 
 // Data Structure Definitions (structs, enums, etc.)//////////////////////////
 
@@ -29,12 +30,20 @@ typedef enum OutputHandlingMessages
 typedef struct OutputType
 {
     char text[ 100 ];
+    Boolean isEvent;
+    SimTime time;
     struct OutputType *next;
+    struct OutputType *last;
 } OutputType;
 
 // Function Prototypes  //////////////////////////////////////////////////////
+OutputType *createOutputLog( void );
+OutputType *appendOutputNode( OutputType *outputLog, char *text );
 void outputLine(ConfigDataType *configDataPtr, OutputType *outputLog,
                                                              char *outputLine);
+void outputEvent( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                            SimTime time, char *eventText );
+void eventToString( SimTime time, char *eventText, char *outString );
 int writeOutputLogToFile( ConfigDataType *configDataPtr,
                                                     OutputType *outputLog );
 OutputType *clearOutputLog( OutputType *outputLog );
@@ -0,0 +1,852 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: Paging.c
+Brief: Implementation file for paged virtual memory code
+Details: Implements a page table for each process, mapping the virtual
+         pages of its allocations to physical frames, and a translation
+         lookaside buffer (TLB) shared by all processes that caches recent
+         translations with least recently used (LRU) replacement; with
+         demand paging, pages without a frame wait on the swap device and
+         are loaded on a page fault, evicting a FIFO, LRU, or Clock victim
+Version: 1.0
+         17 October 2026
+         Initial development of paging code
+Note: Segment s holds virtual addresses s * 2 * BASE_OFFSET onward, so no
+      base and offset of one segment reach the pages of the next
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "Paging.h"
+
+/*
+Function name: createPaging
+Algorithm: Splits available memory into page sized frames, all free, and
+           creates an empty page table for every process and a TLB of the
+           configured size with every entry invalid
+Precondition: Given config and number of processes
+Postcondition: Returns paging data with no pages mapped
+Exceptions: None
+Note: Frames are handed out lowest first; resident frames are also kept
+      in a list from newest to oldest, in load order for FIFO and in use
+      order for LRU
+*/
+PagingType *createPaging( ConfigDataType *configDataPtr, int pcbCount )
+{
+    PagingType *paging = (PagingType *)malloc( sizeof( PagingType ) );
+    Tlb *tlb = &paging->tlb;
+    int index, bucket;
+
+    paging->pageSize = configDataPtr->pageSize;
+    paging->frameCount = configDataPtr->memAvailable / paging->pageSize;
+    paging->freeFrames = (int *)malloc( ( paging->frameCount + 1 )
+                                                            * sizeof( int ) );
+    paging->freeCount = paging->frameCount;
+    paging->frames = (FrameEntry *)malloc( ( paging->frameCount + 1 )
+                                                    * sizeof( FrameEntry ) );
+    paging->newestFrame = NO_FRAME;
+    paging->oldestFrame = NO_FRAME;
+    paging->clockHand = 0;
+    paging->demand = configDataPtr->pagingCode == PAGING_DEMAND_CODE;
+    paging->replacementCode = configDataPtr->pageReplacementCode;
+    paging->swapTime = configDataPtr->swapTime;
+    paging->swapBusyUntil = 0;
+    paging->pagesOut = 0;
+    paging->missCost = configDataPtr->tlbMissCost;
+    paging->walkCost = configDataPtr->pageWalkCost;
+
+    for( index = 0; index < paging->frameCount; index++ )
+    {
+        paging->freeFrames[ index ] = paging->frameCount - 1 - index;
+        paging->frames[ index ].PID = NO_PROCESS;
+        paging->frames[ index ].page = NULL;
+        paging->frames[ index ].referenced = False;
+    }
+
+    paging->tableCount = pcbCount;
+    paging->tables = (PageTable *)malloc( ( pcbCount + 1 )
+                                                    * sizeof( PageTable ) );
+    paging->tlbHits = (long *)calloc( pcbCount + 1, sizeof( long ) );
+    paging->tlbMisses = (long *)calloc( pcbCount + 1, sizeof( long ) );
+    paging->pageFaults = (long *)calloc( pcbCount + 1, sizeof( long ) );
+
+    for( index = 0; index < pcbCount; index++ )
+    {
+        paging->tables[ index ].bucketCount = PAGE_TABLE_INITIAL_BUCKETS;
+        paging->tables[ index ].buckets = (PageEntry **)calloc(
+                            PAGE_TABLE_INITIAL_BUCKETS, sizeof( PageEntry * ) );
+        paging->tables[ index ].pageCount = 0;
+    }
+
+    tlb->entryCount = configDataPtr->tlbEntries;
+    tlb->entries = (TlbEntry *)malloc( tlb->entryCount * sizeof( TlbEntry ) );
+
+    tlb->bucketCount = 1;
+
+    while( tlb->bucketCount < 2 * tlb->entryCount )
+    {
+        tlb->bucketCount *= 2;
+    }
+
+    tlb->buckets = (TlbEntry **)malloc( tlb->bucketCount
+                                                    * sizeof( TlbEntry * ) );
+
+    for( bucket = 0; bucket < tlb->bucketCount; bucket++ )
+    {
+        tlb->buckets[ bucket ] = NULL;
+    }
+
+    for( index = 0; index < tlb->entryCount; index++ )
+    {
+        tlb->entries[ index ].valid = False;
+        tlb->entries[ index ].hashNext = NULL;
+        tlb->entries[ index ].lruPrev =
+                            index > 0 ? &tlb->entries[ index - 1 ] : NULL;
+        tlb->entries[ index ].lruNext = index < tlb->entryCount - 1
+                                        ? &tlb->entries[ index + 1 ] : NULL;
+    }
+
+    tlb->mostRecent = &tlb->entries[ 0 ];
+    tlb->leastRecent = &tlb->entries[ tlb->entryCount - 1 ];
+
+    return paging;
+}
+
+/*
+Function name: findVirtualPage
+Algorithm: Places the address within the virtual span of its segment and
+           divides by the page size
+Precondition: Given paging data, memory segment, and an address within it
+Postcondition: Returns the virtual page number holding the address
+Exceptions: None
+Note: None
+*/
+int findVirtualPage( PagingType *paging, int segment, int address )
+{
+    return ( segment * 2 * BASE_OFFSET + address ) / paging->pageSize;
+}
+
+/*
+Function name: mapPages
+Algorithm: Counts the pages of the allocation the process has not mapped
+           yet and, if there are enough free frames for all of them, maps
+           each one to a free frame
+Precondition: Given paging data, PID, memory segment, memory base, and
+              memory offset of an allocation
+Postcondition: Returns True with every page of addresses base through
+               base + offset mapped, or False with nothing changed when
+               there are not enough free frames
+Exceptions: Returns False for a PID without a page table
+Note: A page shared with an earlier allocation of the same process keeps
+      its frame; with demand paging the pages left over when the free
+      frames run out start on the swap device instead
+*/
+Boolean mapPages( PagingType *paging, int procID, int segment, int base,
+                                                                int offset )
+{
+    PageTable *table;
+    PageEntry *page;
+    int firstPage, lastPage, vpn, needed = 0;
+
+    if( procID < 0 || procID >= paging->tableCount )
+    {
+        return False;
+    }
+
+    table = &paging->tables[ procID ];
+    firstPage = findVirtualPage( paging, segment, base );
+    lastPage = findVirtualPage( paging, segment, base + offset );
+
+    for( vpn = firstPage; vpn <= lastPage; vpn++ )
+    {
+        if( findPageEntry( table, vpn ) == NULL )
+        {
+            needed++;
+        }
+    }
+
+    if( paging->demand == False && needed > paging->freeCount )
+    {
+        return False;
+    }
+
+    for( vpn = firstPage; vpn <= lastPage; vpn++ )
+    {
+        if( findPageEntry( table, vpn ) == NULL )
+        {
+            page = addPageEntry( table, vpn );
+
+            if( paging->freeCount > 0 )
+            {
+                paging->freeCount--;
+                placePage( paging, procID, page,
+                                    paging->freeFrames[ paging->freeCount ] );
+            }
+        }
+    }
+
+    return True;
+}
+
+/*
+Function name: translateAddress
+Algorithm: Looks up the page of the address in the TLB; a hit makes the
+           entry most recently used, a miss walks the page table of the
+           process and loads the translation into the least recently used
+           TLB entry
+Precondition: Given paging data, PID, memory segment, memory base, memory
+              offset, and frame result pointer
+Postcondition: Returns True on a TLB hit and False on a miss; frame holds
+               the physical frame, or NO_FRAME if the page is not mapped
+               or is on the swap device; the hit or miss is counted for the
+               process
+Exceptions: Returns False and NO_FRAME for a PID without a page table
+Note: O(1) expected; the caller charges the miss and walk costs and loads
+      a page that is on the swap device
+*/
+Boolean translateAddress( PagingType *paging, int procID, int segment,
+                                        int base, int offset, int *frame )
+{
+    TlbEntry *tlbEntry;
+    PageEntry *pageEntry;
+    int vpn;
+
+    *frame = NO_FRAME;
+
+    if( procID < 0 || procID >= paging->tableCount )
+    {
+        return False;
+    }
+
+    vpn = findVirtualPage( paging, segment, base + offset );
+    tlbEntry = findTlbEntry( &paging->tlb, procID, vpn );
+
+    if( tlbEntry != NULL )
+    {
+        touchTlbEntry( &paging->tlb, tlbEntry );
+        paging->tlbHits[ procID ]++;
+        *frame = tlbEntry->frame;
+        useFrame( paging, *frame );
+        return True;
+    }
+
+    paging->tlbMisses[ procID ]++;
+    pageEntry = findPageEntry( &paging->tables[ procID ], vpn );
+
+    if( pageEntry != NULL && pageEntry->frame != NO_FRAME )
+    {
+        *frame = pageEntry->frame;
+        fillTlbEntry( &paging->tlb, procID, vpn, pageEntry->frame );
+        useFrame( paging, *frame );
+    }
+
+    return False;
+}
+
+/*
+Function name: loadPage
+Algorithm: Takes a free frame for the page of the address if there is one,
+           otherwise evicts the victim the replacement policy chooses,
+           dropping its translation from the TLB and sending it to the swap
+           device, then maps the page to the frame and caches its
+           translation
+Precondition: Given paging data, PID, memory segment, address within the
+              segment, and victim result pointers
+Postcondition: Returns the frame now holding the page, or NO_FRAME if the
+               page is not mapped or there are no frames; victim PID and
+               page hold the evicted page, or NO_PROCESS when a free frame
+               was used; the fault is counted for the process
+Exceptions: None
+Note: O(1) for FIFO and LRU; Clock sweeps past referenced frames
+*/
+int loadPage( PagingType *paging, int procID, int segment, int address,
+                                            int *victimPID, int *victimVpn )
+{
+    PageEntry *page;
+    TlbEntry *tlbEntry;
+    int vpn, frame;
+
+    *victimPID = NO_PROCESS;
+    *victimVpn = 0;
+
+    if( procID < 0 || procID >= paging->tableCount
+                                                || paging->frameCount == 0 )
+    {
+        return NO_FRAME;
+    }
+
+    vpn = findVirtualPage( paging, segment, address );
+    page = findPageEntry( &paging->tables[ procID ], vpn );
+
+    if( page == NULL || page->frame != NO_FRAME )
+    {
+        return page == NULL ? NO_FRAME : page->frame;
+    }
+
+    if( paging->freeCount > 0 )
+    {
+        paging->freeCount--;
+        frame = paging->freeFrames[ paging->freeCount ];
+    }
+    else
+    {
+        frame = chooseVictimFrame( paging );
+        *victimPID = paging->frames[ frame ].PID;
+        *victimVpn = paging->frames[ frame ].page->vpn;
+        tlbEntry = findTlbEntry( &paging->tlb, *victimPID, *victimVpn );
+
+        if( tlbEntry != NULL )
+        {
+            dropTlbEntry( &paging->tlb, tlbEntry );
+        }
+
+        paging->frames[ frame ].page->frame = NO_FRAME;
+        unlinkFrame( paging, frame );
+        paging->pagesOut++;
+    }
+
+    placePage( paging, procID, page, frame );
+    fillTlbEntry( &paging->tlb, procID, vpn, frame );
+    paging->pageFaults[ procID ]++;
+
+    return frame;
+}
+
+/*
+Function name: scheduleSwap
+Algorithm: Starts the transfer when the swap device finishes the transfers
+           already queued on it, or now if it is idle
+Precondition: Given paging data, current time, and transfer time
+Postcondition: Returns the time the transfer completes; the swap device is
+               busy until then
+Exceptions: None
+Note: Faults queue behind each other, so the wait grows as faults pile up
+*/
+SimTime scheduleSwap( PagingType *paging, SimTime currentTime,
+                                                            int milliSeconds )
+{
+    if( paging->swapBusyUntil < currentTime )
+    {
+        paging->swapBusyUntil = currentTime;
+    }
+
+    paging->swapBusyUntil += msecToSimTime( milliSeconds );
+
+    return paging->swapBusyUntil;
+}
+
+/*
+Function name: findMemoryCapacity
+Algorithm: Adds the swap device to available memory under demand paging
+Precondition: Given config
+Postcondition: Returns the memory, in KB, allocations may use in total
+Exceptions: None
+Note: None
+*/
+int findMemoryCapacity( ConfigDataType *configDataPtr )
+{
+    if( configDataPtr->pagingCode == PAGING_DEMAND_CODE )
+    {
+        return configDataPtr->memAvailable + configDataPtr->swapAvailable;
+    }
+
+    return configDataPtr->memAvailable;
+}
+
+/*
+Function name: releasePages
+Algorithm: Returns every frame mapped by the process to the free frames,
+           empties its page table, and invalidates its TLB entries
+Precondition: Given paging data and PID
+Postcondition: Process has no pages mapped and no translations cached
+Exceptions: None
+Note: The hit, miss, and fault counts of the process are kept for the
+      report
+*/
+void releasePages( PagingType *paging, int procID )
+{
+    PageTable *table;
+    PageEntry *entry, *nextEntry;
+    TlbEntry *tlbEntry;
+    Tlb *tlb = &paging->tlb;
+    int bucket, index;
+
+    if( procID < 0 || procID >= paging->tableCount )
+    {
+        return;
+    }
+
+    table = &paging->tables[ procID ];
+
+    for( bucket = 0; bucket < table->bucketCount; bucket++ )
+    {
+        entry = table->buckets[ bucket ];
+
+        while( entry != NULL )
+        {
+            nextEntry = entry->next;
+
+            if( entry->frame != NO_FRAME )
+            {
+                unlinkFrame( paging, entry->frame );
+                paging->frames[ entry->frame ].page = NULL;
+                paging->freeFrames[ paging->freeCount ] = entry->frame;
+                paging->freeCount++;
+            }
+
+            free( entry );
+            entry = nextEntry;
+        }
+
+        table->buckets[ bucket ] = NULL;
+    }
+
+    table->pageCount = 0;
+
+    for( index = 0; index < tlb->entryCount; index++ )
+    {
+        tlbEntry = &tlb->entries[ index ];
+
+        if( tlbEntry->valid == True && tlbEntry->PID == procID )
+        {
+            dropTlbEntry( tlb, tlbEntry );
+        }
+    }
+}
+
+/*
+Function name: clearPaging
+Algorithm: Returns every page table entry, the page tables, the TLB, the
+           free frames, and the counts to the OS
+Precondition: Given paging data, or NULL
+Postcondition: All memory, if any, is returned to OS, returns NULL
+Exceptions: None
+Note: None
+*/
+PagingType *clearPaging( PagingType *paging )
+{
+    PageEntry *entry, *nextEntry;
+    int index, bucket;
+
+    if( paging != NULL )
+    {
+        for( index = 0; index < paging->tableCount; index++ )
+        {
+            for( bucket = 0; bucket < paging->tables[ index ].bucketCount;
+                                                                    bucket++ )
+            {
+                entry = paging->tables[ index ].buckets[ bucket ];
+
+                while( entry != NULL )
+                {
+                    nextEntry = entry->next;
+                    free( entry );
+                    entry = nextEntry;
+                }
+            }
+
+            free( paging->tables[ index ].buckets );
+        }
+
+        free( paging->tables );
+        free( paging->tlb.entries );
+        free( paging->tlb.buckets );
+        free( paging->freeFrames );
+        free( paging->frames );
+        free( paging->pageFaults );
+        free( paging->tlbHits );
+        free( paging->tlbMisses );
+        free( paging );
+    }
+
+    return NULL;
+}
+
+/*
+Function name: findPageEntry
+Algorithm: Searches the hash bucket of the virtual page for its entry
+Precondition: Given page table and virtual page number
+Postcondition: Returns the page entry, or NULL if the page is not mapped
+Exceptions: None
+Note: O(1) expected
+*/
+PageEntry *findPageEntry( PageTable *table, int vpn )
+{
+    PageEntry *entry = table->buckets[ (unsigned int)vpn
+                                                    % table->bucketCount ];
+
+    while( entry != NULL && entry->vpn != vpn )
+    {
+        entry = entry->next;
+    }
+
+    return entry;
+}
+
+/*
+Function name: addPageEntry
+Algorithm: Grows the table when it holds one entry per bucket, then links
+           a new entry at the head of the bucket of the virtual page
+Precondition: Given page table and an unmapped virtual page number
+Postcondition: Returns the new page entry, not yet in a frame
+Exceptions: None
+Note: None
+*/
+PageEntry *addPageEntry( PageTable *table, int vpn )
+{
+    PageEntry *entry = (PageEntry *)malloc( sizeof( PageEntry ) );
+    unsigned int bucket;
+
+    if( table->pageCount == table->bucketCount )
+    {
+        growPageBuckets( table );
+    }
+
+    bucket = (unsigned int)vpn % table->bucketCount;
+    entry->vpn = vpn;
+    entry->frame = NO_FRAME;
+    entry->next = table->buckets[ bucket ];
+    table->buckets[ bucket ] = entry;
+    table->pageCount++;
+
+    return entry;
+}
+
+/*
+Function name: growPageBuckets
+Algorithm: Doubles the number of hash buckets and moves every entry to its
+           bucket in the new table
+Precondition: Given page table
+Postcondition: Table has twice the buckets, holding the same entries
+Exceptions: None
+Note: Pages of an allocation are consecutive, so hashing by the page number
+      alone spreads them evenly
+*/
+void growPageBuckets( PageTable *table )
+{
+    PageEntry **oldBuckets = table->buckets;
+    PageEntry *entry, *nextEntry;
+    int oldCount = table->bucketCount, bucket;
+    unsigned int newBucket;
+
+    table->bucketCount *= 2;
+    table->buckets = (PageEntry **)calloc( table->bucketCount,
+                                                        sizeof( PageEntry * ) );
+
+    for( bucket = 0; bucket < oldCount; bucket++ )
+    {
+        entry = oldBuckets[ bucket ];
+
+        while( entry != NULL )
+        {
+            nextEntry = entry->next;
+            newBucket = (unsigned int)entry->vpn % table->bucketCount;
+            entry->next = table->buckets[ newBucket ];
+            table->buckets[ newBucket ] = entry;
+            entry = nextEntry;
+        }
+    }
+
+    free( oldBuckets );
+}
+
+/*
+Function name: placePage
+Algorithm: Maps the page to the frame, marks the frame referenced, and links
+           it at the newest end of the frame list
+Precondition: Given paging data, PID, page entry, and a frame not in the
+              list
+Postcondition: Page is resident in the frame
+Exceptions: None
+Note: O(1)
+*/
+void placePage( PagingType *paging, int procID, PageEntry *page, int frame )
+{
+    FrameEntry *entry = &paging->frames[ frame ];
+
+    page->frame = frame;
+    entry->PID = procID;
+    entry->page = page;
+    entry->referenced = True;
+    entry->newer = NO_FRAME;
+    entry->older = paging->newestFrame;
+
+    if( paging->newestFrame != NO_FRAME )
+    {
+        paging->frames[ paging->newestFrame ].newer = frame;
+    }
+    else
+    {
+        paging->oldestFrame = frame;
+    }
+
+    paging->newestFrame = frame;
+}
+
+/*
+Function name: chooseVictimFrame
+Algorithm: For Clock, sweeps the hand over the frames, clearing the
+           referenced bit of each one it passes, until it reaches a frame
+           that is not referenced; for FIFO and LRU, takes the oldest frame
+           of the list
+Precondition: Given paging data with every frame resident
+Postcondition: Returns the frame to evict
+Exceptions: None
+Note: The Clock sweep ends within two turns of the frames
+*/
+int chooseVictimFrame( PagingType *paging )
+{
+    FrameEntry *entry;
+    int frame;
+
+    if( paging->replacementCode != REPLACE_CLOCK_CODE )
+    {
+        return paging->oldestFrame;
+    }
+
+    while( True )
+    {
+        frame = paging->clockHand;
+        entry = &paging->frames[ frame ];
+        paging->clockHand = ( paging->clockHand + 1 ) % paging->frameCount;
+
+        if( entry->page != NULL )
+        {
+            if( entry->referenced == False )
+            {
+                return frame;
+            }
+
+            entry->referenced = False;
+        }
+    }
+}
+
+/*
+Function name: useFrame
+Algorithm: Under demand paging marks the frame referenced and, for LRU,
+           moves it to the newest end of the frame list
+Precondition: Given paging data and a resident frame
+Postcondition: Frame is recorded as just used
+Exceptions: None
+Note: FIFO keeps load order, so it ignores use
+*/
+void useFrame( PagingType *paging, int frame )
+{
+    if( paging->demand == False )
+    {
+        return;
+    }
+
+    paging->frames[ frame ].referenced = True;
+
+    if( paging->replacementCode == REPLACE_LRU_CODE
+                                            && frame != paging->newestFrame )
+    {
+        unlinkFrame( paging, frame );
+        placePage( paging, paging->frames[ frame ].PID,
+                                        paging->frames[ frame ].page, frame );
+    }
+}
+
+/*
+Function name: unlinkFrame
+Algorithm: Joins the frames on either side of the frame in the frame list
+Precondition: Given paging data and a frame in the list
+Postcondition: Frame is not in the list
+Exceptions: None
+Note: O(1)
+*/
+void unlinkFrame( PagingType *paging, int frame )
+{
+    FrameEntry *entry = &paging->frames[ frame ];
+
+    if( entry->newer != NO_FRAME )
+    {
+        paging->frames[ entry->newer ].older = entry->older;
+    }
+    else
+    {
+        paging->newestFrame = entry->older;
+    }
+
+    if( entry->older != NO_FRAME )
+    {
+        paging->frames[ entry->older ].newer = entry->newer;
+    }
+    else
+    {
+        paging->oldestFrame = entry->newer;
+    }
+}
+
+/*
+Function name: findTlbEntry
+Algorithm: Searches the hash bucket of the PID and virtual page for a valid
+           entry
+Precondition: Given TLB, PID, and virtual page number
+Postcondition: Returns the TLB entry, or NULL on a miss
+Exceptions: None
+Note: Only valid entries are linked into buckets
+*/
+TlbEntry *findTlbEntry( Tlb *tlb, int procID, int vpn )
+{
+    TlbEntry *entry = tlb->buckets[ hashTlbKey( procID, vpn )
+                                                & ( tlb->bucketCount - 1 ) ];
+
+    while( entry != NULL )
+    {
+        if( entry->PID == procID && entry->vpn == vpn )
+        {
+            return entry;
+        }
+
+        entry = entry->hashNext;
+    }
+
+    return NULL;
+}
+
+/*
+Function name: fillTlbEntry
+Algorithm: Takes the least recently used entry, drops its old translation
+           from its bucket if it held one, stores the new translation, links
+           it into the bucket of its key, and makes it most recently used
+Precondition: Given TLB, PID, virtual page number, and frame not yet cached
+Postcondition: Translation is cached as the most recently used entry
+Exceptions: None
+Note: None
+*/
+void fillTlbEntry( Tlb *tlb, int procID, int vpn, int frame )
+{
+    TlbEntry *entry = tlb->leastRecent;
+    unsigned int bucket;
+
+    if( entry->valid == True )
+    {
+        unlinkTlbEntry( tlb, entry );
+    }
+
+    entry->PID = procID;
+    entry->vpn = vpn;
+    entry->frame = frame;
+    entry->valid = True;
+
+    bucket = hashTlbKey( procID, vpn ) & ( tlb->bucketCount - 1 );
+    entry->hashNext = tlb->buckets[ bucket ];
+    tlb->buckets[ bucket ] = entry;
+
+    touchTlbEntry( tlb, entry );
+}
+
+/*
+Function name: touchTlbEntry
+Algorithm: Unlinks the entry from the recency list and relinks it at the
+           most recently used end
+Precondition: Given TLB and one of its entries
+Postcondition: Entry is the most recently used
+Exceptions: None
+Note: O(1)
+*/
+void touchTlbEntry( Tlb *tlb, TlbEntry *entry )
+{
+    if( entry == tlb->mostRecent )
+    {
+        return;
+    }
+
+    entry->lruPrev->lruNext = entry->lruNext;
+
+    if( entry->lruNext != NULL )
+    {
+        entry->lruNext->lruPrev = entry->lruPrev;
+    }
+    else
+    {
+        tlb->leastRecent = entry->lruPrev;
+    }
+
+    entry->lruPrev = NULL;
+    entry->lruNext = tlb->mostRecent;
+    tlb->mostRecent->lruPrev = entry;
+    tlb->mostRecent = entry;
+}
+
+/*
+Function name: unlinkTlbEntry
+Algorithm: Walks the hash bucket of the entry's key and unlinks it
+Precondition: Given TLB and a valid entry
+Postcondition: Entry is in no bucket
+Exceptions: None
+Note: Buckets hold about half an entry on average
+*/
+void unlinkTlbEntry( Tlb *tlb, TlbEntry *entry )
+{
+    TlbEntry **link = &tlb->buckets[ hashTlbKey( entry->PID, entry->vpn )
+                                                & ( tlb->bucketCount - 1 ) ];
+
+    while( *link != NULL && *link != entry )
+    {
+        link = &( *link )->hashNext;
+    }
+
+    if( *link != NULL )
+    {
+        *link = entry->hashNext;
+    }
+
+    entry->hashNext = NULL;
+}
+
+/*
+Function name: dropTlbEntry
+Algorithm: Unlinks the entry from its bucket, marks it invalid, and moves it
+           to the least recently used end so it is refilled first
+Precondition: Given TLB and a valid entry
+Postcondition: Entry holds no translation
+Exceptions: None
+Note: None
+*/
+void dropTlbEntry( Tlb *tlb, TlbEntry *entry )
+{
+    unlinkTlbEntry( tlb, entry );
+    entry->valid = False;
+
+    if( entry == tlb->leastRecent )
+    {
+        return;
+    }
+
+    if( entry->lruPrev != NULL )
+    {
+        entry->lruPrev->lruNext = entry->lruNext;
+    }
+    else
+    {
+        tlb->mostRecent = entry->lruNext;
+    }
+
+    entry->lruNext->lruPrev = entry->lruPrev;
+    entry->lruPrev = tlb->leastRecent;
+    entry->lruNext = NULL;
+    tlb->leastRecent->lruNext = entry;
+    tlb->leastRecent = entry;
+}
+
+/*
+Function name: hashTlbKey
+Algorithm: Mixes the PID and virtual page number into one value
+Precondition: Given PID and virtual page number
+Postcondition: Returns hash of the translation key
+Exceptions: None
+Note: None
+*/
+unsigned int hashTlbKey( int procID, int vpn )
+{
+    unsigned int hash = (unsigned int)procID * 31u + (unsigned int)vpn;
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bu;
+    hash ^= hash >> 16;
+
+    return hash;
+}
@@ -0,0 +1,132 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: Paging.h
+Brief: Header file for paged virtual memory code
+Details: Specifies functions, constants, and other information
+         related to the page tables, translation lookaside buffer (TLB),
+         and demand paging to a swap device
+Version: 1.0
+         17 October 2026
+         Initial development of paging code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef PAGING_H
+#define PAGING_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "StringUtils.h"
+#include "ConfigAccess.h"
+#include "SimClock.h"
+#include "MMU.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define PAGE_TABLE_INITIAL_BUCKETS 16
+#define NO_FRAME -1
+#define NO_PROCESS -1
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct PageEntry
+{
+    int vpn;
+    int frame;
+    struct PageEntry *next;
+} PageEntry;
+
+typedef struct PageTable
+{
+    PageEntry **buckets;
+    int bucketCount;
+    int pageCount;
+} PageTable;
+
+typedef struct TlbEntry
+{
+    int PID;
+    int vpn;
+    int frame;
+    Boolean valid;
+    struct TlbEntry *hashNext;
+    struct TlbEntry *lruPrev;
+    struct TlbEntry *lruNext;
+} TlbEntry;
+
+typedef struct Tlb
+{
+    TlbEntry *entries;
+    int entryCount;
+    TlbEntry **buckets;
+    int bucketCount;
+    TlbEntry *mostRecent;
+    TlbEntry *leastRecent;
+} Tlb;
+
+typedef struct FrameEntry
+{
+    int PID;
+    PageEntry *page;
+    Boolean referenced;
+    int newer;
+    int older;
+} FrameEntry;
+
+typedef struct PagingType
+{
+    int pageSize;
+    int frameCount;
+    int *freeFrames;
+    int freeCount;
+    FrameEntry *frames;
+    int newestFrame;
+    int oldestFrame;
+    int clockHand;
+    Boolean demand;
+    int replacementCode;
+    int swapTime;
+    SimTime swapBusyUntil;
+    long *pageFaults;
+    long pagesOut;
+    int tableCount;
+    PageTable *tables;
+    Tlb tlb;
+    int missCost;
+    int walkCost;
+    long *tlbHits;
+    long *tlbMisses;
+} PagingType;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+PagingType *createPaging( ConfigDataType *configDataPtr, int pcbCount );
+int findVirtualPage( PagingType *paging, int segment, int address );
+Boolean mapPages( PagingType *paging, int procID, int segment, int base,
+                                                                int offset );
+Boolean translateAddress( PagingType *paging, int procID, int segment,
+                                        int base, int offset, int *frame );
+int loadPage( PagingType *paging, int procID, int segment, int address,
+                                            int *victimPID, int *victimVpn );
+SimTime scheduleSwap( PagingType *paging, SimTime currentTime,
+                                                            int milliSeconds );
+int findMemoryCapacity( ConfigDataType *configDataPtr );
+void releasePages( PagingType *paging, int procID );
+PagingType *clearPaging( PagingType *paging );
+PageEntry *findPageEntry( PageTable *table, int vpn );
+PageEntry *addPageEntry( PageTable *table, int vpn );
+void growPageBuckets( PageTable *table );
+void placePage( PagingType *paging, int procID, PageEntry *page, int frame );
+int chooseVictimFrame( PagingType *paging );
+void useFrame( PagingType *paging, int frame );
+void unlinkFrame( PagingType *paging, int frame );
+TlbEntry *findTlbEntry( Tlb *tlb, int procID, int vpn );
+void fillTlbEntry( Tlb *tlb, int procID, int vpn, int frame );
+void touchTlbEntry( Tlb *tlb, TlbEntry *entry );
+void unlinkTlbEntry( Tlb *tlb, TlbEntry *entry );
+void dropTlbEntry( Tlb *tlb, TlbEntry *entry );
+unsigned int hashTlbKey( int procID, int vpn );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // PAGING_H
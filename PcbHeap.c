@@ -0,0 +1,270 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: PcbHeap.c
+Brief: Implementation file for pcb priority queue code
+Details: Implements all functions of the indexed pcb min-heap; pcbs are
+         ordered by time remaining, stride pass, deadline, or PID, and
+         every pcb records its own place in the heap so it can be moved
+         or removed without a search
+Version: 1.0
+         17 October 2026
+         Initial development of PcbHeap code
+Note: None
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "PcbHeap.h"
+#include "Simulator.h"
+
+/*
+Function name: createPcbHeap
+Algorithm: Allocates an empty heap with room for the given number of pcbs
+Precondition: Given expected number of pcbs and the key pcbs are ordered by
+Postcondition: Returns pointer to empty heap
+Exceptions: None
+Note: The heap grows if more pcbs are pushed than expected
+*/
+PcbHeap *createPcbHeap( int capacity, PcbHeapKey key )
+{
+    PcbHeap *heap = (PcbHeap *)malloc( sizeof( PcbHeap ) );
+
+    if( capacity < 1 )
+    {
+        capacity = 1;
+    }
+
+    heap->key = key;
+    heap->nodes = (PcbType **)malloc( capacity * sizeof( PcbType * ) );
+    heap->size = 0;
+    heap->capacity = capacity;
+
+    return heap;
+}
+
+/*
+Function name: pushPcbHeap
+Algorithm: Adds the pcb at the bottom of the heap and sifts it up
+Precondition: Given heap and a pcb that is not in the heap
+Postcondition: Pcb is in the heap at its place by the heap key
+Exceptions: None
+Note: O(log n)
+*/
+void pushPcbHeap( PcbHeap *heap, PcbType *pcb )
+{
+    if( heap->size == heap->capacity )
+    {
+        heap->capacity *= 2;
+        heap->nodes = (PcbType **)realloc( heap->nodes,
+                                        heap->capacity * sizeof( PcbType * ) );
+    }
+
+    heap->nodes[ heap->size ] = pcb;
+    pcb->heapIndex = heap->size;
+    heap->size++;
+
+    siftPcbHeapUp( heap, pcb->heapIndex );
+}
+
+/*
+Function name: peekPcbHeap
+Algorithm: Returns the pcb at the top of the heap
+Precondition: Given heap
+Postcondition: Returns pcb with the least key, or NULL if empty
+Exceptions: None
+Note: None
+*/
+PcbType *peekPcbHeap( PcbHeap *heap )
+{
+    if( heap->size == 0 )
+    {
+        return NULL;
+    }
+
+    return heap->nodes[ 0 ];
+}
+
+/*
+Function name: popPcbHeap
+Algorithm: Removes and returns the pcb at the top of the heap
+Precondition: Given heap
+Postcondition: Returns pcb with the least key, or NULL if empty
+Exceptions: None
+Note: O(log n)
+*/
+PcbType *popPcbHeap( PcbHeap *heap )
+{
+    PcbType *top = peekPcbHeap( heap );
+
+    if( top != NULL )
+    {
+        removePcbHeap( heap, top );
+    }
+
+    return top;
+}
+
+/*
+Function name: removePcbHeap
+Algorithm: Moves the last pcb of the heap into the removed pcb's place and
+           sifts it up or down to restore the heap order
+Precondition: Given heap and a pcb that is in the heap
+Postcondition: Pcb is no longer in the heap
+Exceptions: None
+Note: O(log n)
+*/
+void removePcbHeap( PcbHeap *heap, PcbType *pcb )
+{
+    int index = pcb->heapIndex;
+
+    heap->size--;
+    pcb->heapIndex = -1;
+
+    if( index == heap->size )
+    {
+        return;
+    }
+
+    heap->nodes[ index ] = heap->nodes[ heap->size ];
+    heap->nodes[ index ]->heapIndex = index;
+
+    siftPcbHeapUp( heap, index );
+    siftPcbHeapDown( heap, heap->nodes[ index ]->heapIndex );
+}
+
+/*
+Function name: decreasePcbKey
+Algorithm: Sifts the pcb up after its time remaining has dropped
+Precondition: Given heap and a pcb in the heap whose time remaining has
+              not grown since it was placed
+Postcondition: Heap order is restored
+Exceptions: None
+Note: O(log n); does nothing for a heap ordered by PID
+*/
+void decreasePcbKey( PcbHeap *heap, PcbType *pcb )
+{
+    siftPcbHeapUp( heap, pcb->heapIndex );
+}
+
+/*
+Function name: pcbHeapBefore
+Algorithm: Orders pcbs by the key of the heap; a pcb with no deadline
+           comes after every pcb with one; ties are ordered by PID
+Precondition: Given heap and two pcbs
+Postcondition: Returns True if the first pcb belongs above the second
+Exceptions: None
+Note: Equal times keep the order the pcbs were created in, as the stable
+      sort of the pcb queue did
+*/
+Boolean pcbHeapBefore( PcbHeap *heap, PcbType *first, PcbType *second )
+{
+    if( heap->key == HEAP_KEY_TIME_REMAINING
+                        && first->timeRemaining != second->timeRemaining )
+    {
+        return first->timeRemaining < second->timeRemaining;
+    }
+
+    if( heap->key == HEAP_KEY_PASS && first->pass != second->pass )
+    {
+        return first->pass < second->pass;
+    }
+
+    if( heap->key == HEAP_KEY_DEADLINE && first->deadline != second->deadline )
+    {
+        if( first->deadline == 0 || second->deadline == 0 )
+        {
+            return second->deadline == 0;
+        }
+
+        return first->deadline < second->deadline;
+    }
+
+    return first->PID < second->PID;
+}
+
+/*
+Function name: siftPcbHeapUp
+Algorithm: Swaps the pcb at the index with its parent while it belongs
+           above the parent
+Precondition: Given heap and an index in the heap
+Postcondition: Pcb is no lower than its place by the heap key
+Exceptions: None
+Note: None
+*/
+void siftPcbHeapUp( PcbHeap *heap, int index )
+{
+    PcbType *pcb = heap->nodes[ index ];
+    int parent;
+
+    while( index > 0 )
+    {
+        parent = ( index - 1 ) / 2;
+
+        if( pcbHeapBefore( heap, pcb, heap->nodes[ parent ] ) == False )
+        {
+            break;
+        }
+
+        heap->nodes[ index ] = heap->nodes[ parent ];
+        heap->nodes[ index ]->heapIndex = index;
+        index = parent;
+    }
+
+    heap->nodes[ index ] = pcb;
+    pcb->heapIndex = index;
+}
+
+/*
+Function name: siftPcbHeapDown
+Algorithm: Swaps the pcb at the index with its earlier child while that
+           child belongs above it
+Precondition: Given heap and an index in the heap
+Postcondition: Pcb is no higher than its place by the heap key
+Exceptions: None
+Note: None
+*/
+void siftPcbHeapDown( PcbHeap *heap, int index )
+{
+    PcbType *pcb = heap->nodes[ index ];
+    int child;
+
+    while( ( child = 2 * index + 1 ) < heap->size )
+    {
+        if( child + 1 < heap->size
+            && pcbHeapBefore( heap, heap->nodes[ child + 1 ],
+                                            heap->nodes[ child ] ) == True )
+        {
+            child++;
+        }
+
+        if( pcbHeapBefore( heap, heap->nodes[ child ], pcb ) == False )
+        {
+            break;
+        }
+
+        heap->nodes[ index ] = heap->nodes[ child ];
+        heap->nodes[ index ]->heapIndex = index;
+        index = child;
+    }
+
+    heap->nodes[ index ] = pcb;
+    pcb->heapIndex = index;
+}
+
+/*
+Function name: clearPcbHeap
+Algorithm: Returns the heap memory to OS
+Precondition: Given heap, or NULL
+Postcondition: Heap memory is returned to OS, return pointer is set to null
+Exceptions: None
+Note: The pcbs themselves belong to the pcb queue and are not freed
+*/
+PcbHeap *clearPcbHeap( PcbHeap *heap )
+{
+    if( heap != NULL )
+    {
+        free( heap->nodes );
+        free( heap );
+    }
+
+    return NULL;
+}
@@ -0,0 +1,57 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: PcbHeap.h
+Brief: Header file for pcb priority queue code
+Details: Specifies functions, constants, and other information
+         related to the indexed pcb min-heap code
+Version: 1.0
+         17 October 2026
+         Initial development of PcbHeap code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef PCB_HEAP_H
+#define PCB_HEAP_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+struct PcbType;
+
+typedef enum PcbHeapKey
+{
+    HEAP_KEY_TIME_REMAINING,
+    HEAP_KEY_PID,
+    HEAP_KEY_PASS,
+    HEAP_KEY_DEADLINE
+} PcbHeapKey;
+
+typedef struct PcbHeap
+{
+    PcbHeapKey key;
+    struct PcbType **nodes;
+    int size;
+    int capacity;
+} PcbHeap;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+PcbHeap *createPcbHeap( int capacity, PcbHeapKey key );
+void pushPcbHeap( PcbHeap *heap, struct PcbType *pcb );
+struct PcbType *peekPcbHeap( PcbHeap *heap );
+struct PcbType *popPcbHeap( PcbHeap *heap );
+void removePcbHeap( PcbHeap *heap, struct PcbType *pcb );
+void decreasePcbKey( PcbHeap *heap, struct PcbType *pcb );
+Boolean pcbHeapBefore( PcbHeap *heap, struct PcbType *first,
+                                                    struct PcbType *second );
+void siftPcbHeapUp( PcbHeap *heap, int index );
+void siftPcbHeapDown( PcbHeap *heap, int index );
+PcbHeap *clearPcbHeap( PcbHeap *heap );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // PCB_HEAP_H
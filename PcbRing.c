@@ -0,0 +1,117 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: PcbRing.c
+Brief: Implementation file for pcb ring buffer code
+Details: Implements all functions of the pcb FIFO ring buffer used as the
+         round robin ready queue
+Version: 1.0
+         17 October 2026
+         Initial development of PcbRing code
+Note: None
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "PcbRing.h"
+#include "Simulator.h"
+
+/*
+Function name: createPcbRing
+Algorithm: Allocates an empty ring with room for the given number of pcbs
+Precondition: Given expected number of pcbs
+Postcondition: Returns pointer to empty ring
+Exceptions: None
+Note: The ring grows if more pcbs are pushed than expected
+*/
+PcbRing *createPcbRing( int capacity )
+{
+    PcbRing *ring = (PcbRing *)malloc( sizeof( PcbRing ) );
+
+    if( capacity < 1 )
+    {
+        capacity = 1;
+    }
+
+    ring->slots = (PcbType **)malloc( capacity * sizeof( PcbType * ) );
+    ring->head = 0;
+    ring->count = 0;
+    ring->capacity = capacity;
+
+    return ring;
+}
+
+/*
+Function name: pushPcbRing
+Algorithm: Stores the pcb in the slot after the last one in use; a full
+           ring is first copied into one twice its size, oldest pcb first
+Precondition: Given ring and a pcb that is not in the ring
+Postcondition: Pcb is at the tail of the ring
+Exceptions: None
+Note: O(1) unless the ring grows
+*/
+void pushPcbRing( PcbRing *ring, PcbType *pcb )
+{
+    PcbType **slots;
+    int index;
+
+    if( ring->count == ring->capacity )
+    {
+        slots = (PcbType **)malloc( 2 * ring->capacity * sizeof( PcbType * ) );
+
+        for( index = 0; index < ring->count; index++ )
+        {
+            slots[ index ] = ring->slots[ ( ring->head + index )
+                                                        % ring->capacity ];
+        }
+
+        free( ring->slots );
+        ring->slots = slots;
+        ring->head = 0;
+        ring->capacity *= 2;
+    }
+
+    ring->slots[ ( ring->head + ring->count ) % ring->capacity ] = pcb;
+    ring->count++;
+}
+
+/*
+Function name: popPcbRing
+Algorithm: Takes the pcb at the head of the ring
+Precondition: Given ring
+Postcondition: Returns the pcb that has waited longest, or NULL if empty
+Exceptions: None
+Note: O(1)
+*/
+PcbType *popPcbRing( PcbRing *ring )
+{
+    PcbType *pcb;
+
+    if( ring->count == 0 )
+    {
+        return NULL;
+    }
+
+    pcb = ring->slots[ ring->head ];
+    ring->head = ( ring->head + 1 ) % ring->capacity;
+    ring->count--;
+
+    return pcb;
+}
+
+/*
+Function name: clearPcbRing
+Algorithm: Returns the ring memory to OS
+Precondition: Given ring, or NULL
+Postcondition: Ring memory is returned to OS, return pointer is set to null
+Exceptions: None
+Note: The pcbs themselves belong to the pcb queue and are not freed
+*/
+PcbRing *clearPcbRing( PcbRing *ring )
+{
+    if( ring != NULL )
+    {
+        free( ring->slots );
+        free( ring );
+    }
+
+    return NULL;
+}
@@ -0,0 +1,42 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: PcbRing.h
+Brief: Header file for pcb ring buffer code
+Details: Specifies functions, constants, and other information
+         related to the pcb FIFO ring buffer code
+Version: 1.0
+         17 October 2026
+         Initial development of PcbRing code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef PCB_RING_H
+#define PCB_RING_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+struct PcbType;
+
+typedef struct PcbRing
+{
+    struct PcbType **slots;
+    int head;
+    int count;
+    int capacity;
+} PcbRing;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+PcbRing *createPcbRing( int capacity );
+void pushPcbRing( PcbRing *ring, struct PcbType *pcb );
+struct PcbType *popPcbRing( PcbRing *ring );
+PcbRing *clearPcbRing( PcbRing *ring );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // PCB_RING_H
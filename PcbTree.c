@@ -0,0 +1,482 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: PcbTree.c
+Brief: Implementation file for pcb balanced tree code
+Details: Implements all functions of the red-black tree of pcbs ordered by
+         virtual runtime; the tree links live in the pcbs themselves and
+         the leftmost pcb is cached so the next one to run is found in O(1)
+Version: 1.0
+         17 October 2026
+         Initial development of PcbTree code
+Note: A missing child counts as a black leaf
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "PcbTree.h"
+#include "Simulator.h"
+
+/*
+Function name: createPcbTree
+Algorithm: Allocates an empty tree
+Precondition: None
+Postcondition: Returns pointer to empty tree
+Exceptions: None
+Note: None
+*/
+PcbTree *createPcbTree( void )
+{
+    PcbTree *tree = (PcbTree *)malloc( sizeof( PcbTree ) );
+
+    tree->root = NULL;
+    tree->leftmost = NULL;
+    tree->size = 0;
+
+    return tree;
+}
+
+/*
+Function name: insertPcbTree
+Algorithm: Walks down from the root to the leaf where the pcb belongs,
+           links it there as a red node, and rebalances
+Precondition: Given tree and a pcb that is not in the tree
+Postcondition: Pcb is in the tree at its place by virtual runtime
+Exceptions: None
+Note: O(log n)
+*/
+void insertPcbTree( PcbTree *tree, PcbType *pcb )
+{
+    PcbType **link = &tree->root;
+    PcbType *parent = NULL;
+    Boolean leftmost = True;
+
+    while( *link != NULL )
+    {
+        parent = *link;
+
+        if( pcbTreeBefore( pcb, parent ) == True )
+        {
+            link = &parent->treeLeft;
+        }
+        else
+        {
+            link = &parent->treeRight;
+            leftmost = False;
+        }
+    }
+
+    pcb->treeParent = parent;
+    pcb->treeLeft = NULL;
+    pcb->treeRight = NULL;
+    pcb->treeRed = True;
+    *link = pcb;
+
+    if( leftmost == True )
+    {
+        tree->leftmost = pcb;
+    }
+
+    tree->size++;
+    fixPcbTreeInsert( tree, pcb );
+}
+
+/*
+Function name: removePcbTree
+Algorithm: Unlinks the pcb, putting its successor in its place when it has
+           two children, and rebalances if a black node was taken out
+Precondition: Given tree and a pcb that is in the tree
+Postcondition: Pcb is no longer in the tree
+Exceptions: None
+Note: O(log n)
+*/
+void removePcbTree( PcbTree *tree, PcbType *pcb )
+{
+    PcbType *moved = pcb, *child, *childParent;
+    Boolean movedRed = pcb->treeRed;
+
+    if( tree->leftmost == pcb )
+    {
+        tree->leftmost = nextPcbTree( pcb );
+    }
+
+    if( pcb->treeLeft == NULL )
+    {
+        child = pcb->treeRight;
+        childParent = pcb->treeParent;
+        replacePcbTree( tree, pcb, pcb->treeRight );
+    }
+    else if( pcb->treeRight == NULL )
+    {
+        child = pcb->treeLeft;
+        childParent = pcb->treeParent;
+        replacePcbTree( tree, pcb, pcb->treeLeft );
+    }
+    else
+    {
+        moved = nextPcbTree( pcb );
+        movedRed = moved->treeRed;
+        child = moved->treeRight;
+
+        if( moved->treeParent == pcb )
+        {
+            childParent = moved;
+        }
+        else
+        {
+            childParent = moved->treeParent;
+            replacePcbTree( tree, moved, moved->treeRight );
+            moved->treeRight = pcb->treeRight;
+            moved->treeRight->treeParent = moved;
+        }
+
+        replacePcbTree( tree, pcb, moved );
+        moved->treeLeft = pcb->treeLeft;
+        moved->treeLeft->treeParent = moved;
+        moved->treeRed = pcb->treeRed;
+    }
+
+    tree->size--;
+
+    if( movedRed == False )
+    {
+        fixPcbTreeRemove( tree, child, childParent );
+    }
+}
+
+/*
+Function name: firstPcbTree
+Algorithm: Returns the cached leftmost pcb
+Precondition: Given tree
+Postcondition: Returns pcb with the least virtual runtime, or NULL if empty
+Exceptions: None
+Note: O(1)
+*/
+PcbType *firstPcbTree( PcbTree *tree )
+{
+    return tree->leftmost;
+}
+
+/*
+Function name: pcbTreeBefore
+Algorithm: Orders pcbs by virtual runtime, ties by PID
+Precondition: Given two pcbs
+Postcondition: Returns True if the first pcb belongs left of the second
+Exceptions: None
+Note: None
+*/
+Boolean pcbTreeBefore( PcbType *first, PcbType *second )
+{
+    if( first->vruntime != second->vruntime )
+    {
+        return first->vruntime < second->vruntime;
+    }
+
+    return first->PID < second->PID;
+}
+
+/*
+Function name: isPcbTreeRed
+Algorithm: Returns the color of the node, a missing node being black
+Precondition: Given pcb in a tree, or NULL
+Postcondition: Returns True if the node is red
+Exceptions: None
+Note: None
+*/
+Boolean isPcbTreeRed( PcbType *pcb )
+{
+    return pcb != NULL && pcb->treeRed == True;
+}
+
+/*
+Function name: replacePcbTree
+Algorithm: Hangs the replacement, or nothing, where the old pcb hung from
+           its parent
+Precondition: Given tree, a pcb in the tree, and its replacement or NULL
+Postcondition: Replacement takes the old pcb's place under its parent
+Exceptions: None
+Note: The children of the old pcb are not moved
+*/
+void replacePcbTree( PcbTree *tree, PcbType *oldPcb, PcbType *newPcb )
+{
+    if( oldPcb->treeParent == NULL )
+    {
+        tree->root = newPcb;
+    }
+    else if( oldPcb == oldPcb->treeParent->treeLeft )
+    {
+        oldPcb->treeParent->treeLeft = newPcb;
+    }
+    else
+    {
+        oldPcb->treeParent->treeRight = newPcb;
+    }
+
+    if( newPcb != NULL )
+    {
+        newPcb->treeParent = oldPcb->treeParent;
+    }
+}
+
+/*
+Function name: rotatePcbTreeLeft
+Algorithm: Lifts the right child of the pcb into its place, with the pcb
+           as that child's new left child
+Precondition: Given tree and a pcb with a right child
+Postcondition: Order of the tree is unchanged
+Exceptions: None
+Note: None
+*/
+void rotatePcbTreeLeft( PcbTree *tree, PcbType *pcb )
+{
+    PcbType *child = pcb->treeRight;
+
+    pcb->treeRight = child->treeLeft;
+
+    if( child->treeLeft != NULL )
+    {
+        child->treeLeft->treeParent = pcb;
+    }
+
+    replacePcbTree( tree, pcb, child );
+    child->treeLeft = pcb;
+    pcb->treeParent = child;
+}
+
+/*
+Function name: rotatePcbTreeRight
+Algorithm: Lifts the left child of the pcb into its place, with the pcb
+           as that child's new right child
+Precondition: Given tree and a pcb with a left child
+Postcondition: Order of the tree is unchanged
+Exceptions: None
+Note: None
+*/
+void rotatePcbTreeRight( PcbTree *tree, PcbType *pcb )
+{
+    PcbType *child = pcb->treeLeft;
+
+    pcb->treeLeft = child->treeRight;
+
+    if( child->treeRight != NULL )
+    {
+        child->treeRight->treeParent = pcb;
+    }
+
+    replacePcbTree( tree, pcb, child );
+    child->treeRight = pcb;
+    pcb->treeParent = child;
+}
+
+/*
+Function name: fixPcbTreeInsert
+Algorithm: While the new red node has a red parent, recolors when its
+           uncle is red, otherwise rotates it under its grandparent
+Precondition: Given tree and the pcb just linked in as red
+Postcondition: No red node has a red child and the root is black
+Exceptions: None
+Note: None
+*/
+void fixPcbTreeInsert( PcbTree *tree, PcbType *pcb )
+{
+    PcbType *parent, *grandparent, *uncle;
+
+    while( isPcbTreeRed( parent = pcb->treeParent ) == True )
+    {
+        grandparent = parent->treeParent;
+
+        if( parent == grandparent->treeLeft )
+        {
+            uncle = grandparent->treeRight;
+
+            if( isPcbTreeRed( uncle ) == True )
+            {
+                parent->treeRed = False;
+                uncle->treeRed = False;
+                grandparent->treeRed = True;
+                pcb = grandparent;
+                continue;
+            }
+
+            if( pcb == parent->treeRight )
+            {
+                rotatePcbTreeLeft( tree, parent );
+                pcb = parent;
+                parent = pcb->treeParent;
+            }
+
+            parent->treeRed = False;
+            grandparent->treeRed = True;
+            rotatePcbTreeRight( tree, grandparent );
+        }
+        else
+        {
+            uncle = grandparent->treeLeft;
+
+            if( isPcbTreeRed( uncle ) == True )
+            {
+                parent->treeRed = False;
+                uncle->treeRed = False;
+                grandparent->treeRed = True;
+                pcb = grandparent;
+                continue;
+            }
+
+            if( pcb == parent->treeLeft )
+            {
+                rotatePcbTreeRight( tree, parent );
+                pcb = parent;
+                parent = pcb->treeParent;
+            }
+
+            parent->treeRed = False;
+            grandparent->treeRed = True;
+            rotatePcbTreeLeft( tree, grandparent );
+        }
+    }
+
+    tree->root->treeRed = False;
+}
+
+/*
+Function name: fixPcbTreeRemove
+Algorithm: Pushes the missing black up from the node that replaced a
+           removed black node, recoloring and rotating around its sibling
+           until it can be absorbed
+Precondition: Given tree, the node that took the removed node's place or
+              NULL, and that node's parent
+Postcondition: Every path from the root to a leaf has the same number of
+               black nodes
+Exceptions: None
+Note: The parent is passed because the node may be a missing leaf
+*/
+void fixPcbTreeRemove( PcbTree *tree, PcbType *pcb, PcbType *parent )
+{
+    PcbType *sibling;
+
+    while( pcb != tree->root && isPcbTreeRed( pcb ) == False )
+    {
+        if( pcb == parent->treeLeft )
+        {
+            sibling = parent->treeRight;
+
+            if( isPcbTreeRed( sibling ) == True )
+            {
+                sibling->treeRed = False;
+                parent->treeRed = True;
+                rotatePcbTreeLeft( tree, parent );
+                sibling = parent->treeRight;
+            }
+
+            if( isPcbTreeRed( sibling->treeLeft ) == False
+                && isPcbTreeRed( sibling->treeRight ) == False )
+            {
+                sibling->treeRed = True;
+                pcb = parent;
+                parent = pcb->treeParent;
+                continue;
+            }
+
+            if( isPcbTreeRed( sibling->treeRight ) == False )
+            {
+                sibling->treeLeft->treeRed = False;
+                sibling->treeRed = True;
+                rotatePcbTreeRight( tree, sibling );
+                sibling = parent->treeRight;
+            }
+
+            sibling->treeRed = parent->treeRed;
+            parent->treeRed = False;
+            sibling->treeRight->treeRed = False;
+            rotatePcbTreeLeft( tree, parent );
+        }
+        else
+        {
+            sibling = parent->treeLeft;
+
+            if( isPcbTreeRed( sibling ) == True )
+            {
+                sibling->treeRed = False;
+                parent->treeRed = True;
+                rotatePcbTreeRight( tree, parent );
+                sibling = parent->treeLeft;
+            }
+
+            if( isPcbTreeRed( sibling->treeLeft ) == False
+                && isPcbTreeRed( sibling->treeRight ) == False )
+            {
+                sibling->treeRed = True;
+                pcb = parent;
+                parent = pcb->treeParent;
+                continue;
+            }
+
+            if( isPcbTreeRed( sibling->treeLeft ) == False )
+            {
+                sibling->treeRight->treeRed = False;
+                sibling->treeRed = True;
+                rotatePcbTreeLeft( tree, sibling );
+                sibling = parent->treeLeft;
+            }
+
+            sibling->treeRed = parent->treeRed;
+            parent->treeRed = False;
+            sibling->treeLeft->treeRed = False;
+            rotatePcbTreeRight( tree, parent );
+        }
+
+        pcb = tree->root;
+    }
+
+    if( pcb != NULL )
+    {
+        pcb->treeRed = False;
+    }
+}
+
+/*
+Function name: nextPcbTree
+Algorithm: Returns the leftmost pcb of the right subtree, or else the first
+           ancestor reached from a left child
+Precondition: Given pcb in a tree
+Postcondition: Returns the in-order successor, or NULL for the last pcb
+Exceptions: None
+Note: None
+*/
+PcbType *nextPcbTree( PcbType *pcb )
+{
+    if( pcb->treeRight != NULL )
+    {
+        pcb = pcb->treeRight;
+
+        while( pcb->treeLeft != NULL )
+        {
+            pcb = pcb->treeLeft;
+        }
+
+        return pcb;
+    }
+
+    while( pcb->treeParent != NULL && pcb == pcb->treeParent->treeRight )
+    {
+        pcb = pcb->treeParent;
+    }
+
+    return pcb->treeParent;
+}
+
+/*
+Function name: clearPcbTree
+Algorithm: Returns the tree memory to OS
+Precondition: Given tree, or NULL
+Postcondition: Tree memory is returned to OS, return pointer is set to null
+Exceptions: None
+Note: The pcbs themselves belong to the pcb queue and are not freed
+*/
+PcbTree *clearPcbTree( PcbTree *tree )
+{
+    if( tree != NULL )
+    {
+        free( tree );
+    }
+
+    return NULL;
+}
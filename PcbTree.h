@@ -0,0 +1,52 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: PcbTree.h
+Brief: Header file for pcb balanced tree code
+Details: Specifies functions, constants, and other information
+         related to pcb balanced tree code
+Version: 1.0
+         17 October 2026
+         Initial development of PcbTree code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef PCB_TREE_H
+#define PCB_TREE_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+struct PcbType;
+
+typedef struct PcbTree
+{
+    struct PcbType *root;
+    struct PcbType *leftmost;
+    int size;
+} PcbTree;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+PcbTree *createPcbTree( void );
+void insertPcbTree( PcbTree *tree, struct PcbType *pcb );
+void removePcbTree( PcbTree *tree, struct PcbType *pcb );
+struct PcbType *firstPcbTree( PcbTree *tree );
+Boolean pcbTreeBefore( struct PcbType *first, struct PcbType *second );
+Boolean isPcbTreeRed( struct PcbType *pcb );
+void replacePcbTree( PcbTree *tree, struct PcbType *oldPcb,
+                                                    struct PcbType *newPcb );
+void rotatePcbTreeLeft( PcbTree *tree, struct PcbType *pcb );
+void rotatePcbTreeRight( PcbTree *tree, struct PcbType *pcb );
+void fixPcbTreeInsert( PcbTree *tree, struct PcbType *pcb );
+void fixPcbTreeRemove( PcbTree *tree, struct PcbType *pcb,
+                                                    struct PcbType *parent );
+struct PcbType *nextPcbTree( struct PcbType *pcb );
+PcbTree *clearPcbTree( PcbTree *tree );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // PCB_TREE_H
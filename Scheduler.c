@@ -0,0 +1,341 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: Scheduler.c
+Brief: Implementation file for CPU scheduling policy code
+Details: Implements the scheduling policies the simulator engine calls;
+         each policy keeps its READY processes in the data structure that
+         suits it and is reached only through the Scheduler hooks
+Version: 1.0
+         17 October 2026
+         Initial development of Scheduler code
+Note: None
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "Scheduler.h"
+#include "MlfqScheduler.h"
+#include "StrideScheduler.h"
+#include "EdfScheduler.h"
+#include "CfsScheduler.h"
+
+/*
+Function name: createScheduler
+Algorithm: Builds the policy named by the cpu schedule code of the config;
+           FCFS-N and RR-P keep a FIFO ring, SJF-N and SRTF-P a heap keyed
+           on time remaining, FCFS-P a heap keyed on PID, MLFQ-P one ring
+           per priority level, STRIDE-P and LOTTERY-P a heap keyed on stride
+           pass, EDF-P a heap keyed on deadline, and CFS-P a red-black
+           tree keyed on virtual runtime
+Precondition: Given simulator config, the number of processes, and the
+              scheduler of another core to share accounting with, or NULL
+Postcondition: Returns scheduler with an empty ready structure
+Exceptions: None
+Note: New policies are added here and need no change to the engine; the
+      ready structure always belongs to one core, while accounting that
+      must follow a process between cores is shared with shareWith
+*/
+Scheduler *createScheduler( ConfigDataType *configDataPtr, int pcbCount,
+                                                    Scheduler *shareWith )
+{
+    Scheduler *scheduler = (Scheduler *)malloc( sizeof( Scheduler ) );
+
+    scheduler->cpuSchedCode = configDataPtr->cpuSchedCode;
+    scheduler->quantumCycles = configDataPtr->quantumCycles;
+    scheduler->sharedData = NULL;
+    scheduler->ownsShared = False;
+    scheduler->preemptive = True;
+    scheduler->quantum = fixedQuantum;
+    scheduler->onTick = ignoreTick;
+    scheduler->onBlock = ignorePcb;
+    scheduler->onExit = ignorePcb;
+    scheduler->onMigrate = ignorePcb;
+    scheduler->preempts = alwaysPreempts;
+    scheduler->report = ignoreReport;
+
+    switch( configDataPtr->cpuSchedCode )
+    {
+        case CPU_SCHED_SJF_N_CODE:
+        case CPU_SCHED_SRTF_P_CODE:
+        case CPU_SCHED_FCFS_P_CODE:
+            if( configDataPtr->cpuSchedCode == CPU_SCHED_FCFS_P_CODE )
+            {
+                scheduler->policyData = createPcbHeap( pcbCount,
+                                                                HEAP_KEY_PID );
+            }
+            else
+            {
+                scheduler->policyData = createPcbHeap( pcbCount,
+                                                    HEAP_KEY_TIME_REMAINING );
+            }
+
+            if( configDataPtr->cpuSchedCode == CPU_SCHED_SRTF_P_CODE )
+            {
+                scheduler->preempts = shorterPreempts;
+            }
+
+            scheduler->preemptive =
+                        configDataPtr->cpuSchedCode != CPU_SCHED_SJF_N_CODE;
+            scheduler->enqueue = heapEnqueue;
+            scheduler->onWake = heapEnqueue;
+            scheduler->pickNext = heapPickNext;
+            scheduler->clearPolicy = clearHeapPolicy;
+            break;
+
+        case CPU_SCHED_MLFQ_P_CODE:
+            createMlfqPolicy( scheduler, configDataPtr, pcbCount, shareWith );
+            break;
+
+        case CPU_SCHED_STRIDE_P_CODE:
+        case CPU_SCHED_LOTTERY_P_CODE:
+            createStridePolicy( scheduler, configDataPtr, pcbCount,
+                                                                shareWith );
+            break;
+
+        case CPU_SCHED_EDF_P_CODE:
+            createEdfPolicy( scheduler, configDataPtr, pcbCount, shareWith );
+            break;
+
+        case CPU_SCHED_CFS_P_CODE:
+            createCfsPolicy( scheduler, configDataPtr, pcbCount, shareWith );
+            break;
+
+        default:
+            scheduler->policyData = createPcbRing( pcbCount );
+            scheduler->preemptive =
+                        configDataPtr->cpuSchedCode != CPU_SCHED_FCFS_N_CODE;
+            scheduler->enqueue = ringEnqueue;
+            scheduler->onWake = ringEnqueue;
+            scheduler->pickNext = ringPickNext;
+            scheduler->clearPolicy = clearRingPolicy;
+            break;
+    }
+
+    return scheduler;
+}
+
+/*
+Function name: clearScheduler
+Algorithm: Lets the policy free its ready structure, then frees the
+           scheduler
+Precondition: Given scheduler, or NULL
+Postcondition: Scheduler memory is returned to OS, return pointer is set
+               to null
+Exceptions: None
+Note: The pcbs themselves belong to the pcb queue and are not freed
+*/
+Scheduler *clearScheduler( Scheduler *scheduler )
+{
+    if( scheduler != NULL )
+    {
+        scheduler->clearPolicy( scheduler );
+        free( scheduler );
+    }
+
+    return NULL;
+}
+
+/*
+Function name: heapEnqueue
+Algorithm: Pushes the pcb onto the policy heap
+Precondition: Given heap scheduler and a READY pcb not in the heap
+Postcondition: Pcb is in the heap at its place by the heap key
+Exceptions: None
+Note: O(log n)
+*/
+void heapEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    pushPcbHeap( (PcbHeap *)scheduler->policyData, pcb );
+}
+
+/*
+Function name: heapPickNext
+Algorithm: Pops the top of the policy heap
+Precondition: Given heap scheduler
+Postcondition: Returns pcb with the least key, or NULL if none is READY
+Exceptions: None
+Note: O(log n)
+*/
+PcbType *heapPickNext( Scheduler *scheduler )
+{
+    return popPcbHeap( (PcbHeap *)scheduler->policyData );
+}
+
+/*
+Function name: clearHeapPolicy
+Algorithm: Frees the policy heap
+Precondition: Given heap scheduler
+Postcondition: Heap memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearHeapPolicy( Scheduler *scheduler )
+{
+    scheduler->policyData = clearPcbHeap( (PcbHeap *)scheduler->policyData );
+}
+
+/*
+Function name: ringEnqueue
+Algorithm: Pushes the pcb onto the tail of the policy ring
+Precondition: Given ring scheduler and a READY pcb not in the ring
+Postcondition: Pcb is last in line
+Exceptions: None
+Note: O(1)
+*/
+void ringEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    pushPcbRing( (PcbRing *)scheduler->policyData, pcb );
+}
+
+/*
+Function name: ringPickNext
+Algorithm: Pops the head of the policy ring
+Precondition: Given ring scheduler
+Postcondition: Returns pcb that has waited longest, or NULL if none is READY
+Exceptions: None
+Note: O(1)
+*/
+PcbType *ringPickNext( Scheduler *scheduler )
+{
+    return popPcbRing( (PcbRing *)scheduler->policyData );
+}
+
+/*
+Function name: clearRingPolicy
+Algorithm: Frees the policy ring
+Precondition: Given ring scheduler
+Postcondition: Ring memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearRingPolicy( Scheduler *scheduler )
+{
+    scheduler->policyData = clearPcbRing( (PcbRing *)scheduler->policyData );
+}
+
+/*
+Function name: getPcbShares
+Algorithm: Returns the shares of the pcb, or DEFAULT_PCB_SHARES when its
+           A(start) line gave none
+Precondition: Given pcb
+Postcondition: Returns shares of at least one
+Exceptions: None
+Note: None
+*/
+int getPcbShares( PcbType *pcb )
+{
+    if( pcb->shares < 1 )
+    {
+        return DEFAULT_PCB_SHARES;
+    }
+
+    return pcb->shares;
+}
+
+/*
+Function name: fixedQuantum
+Algorithm: Returns the configured quantum for a preemptive policy and no
+           limit for a non-preemptive one
+Precondition: Given scheduler and the pcb being dispatched
+Postcondition: Returns number of cycles the pcb may run before preemption
+Exceptions: None
+Note: None
+*/
+int fixedQuantum( Scheduler *scheduler, PcbType *pcb )
+{
+    (void)pcb;
+
+    if( scheduler->preemptive == False )
+    {
+        return INT_MAX;
+    }
+
+    return scheduler->quantumCycles;
+}
+
+/*
+Function name: alwaysPreempts
+Algorithm: Returns true; the running process gives up the CPU at every
+           I/O completion and the policy picks again
+Precondition: Given scheduler, running pcb, and pcb just made READY
+Postcondition: Returns True
+Exceptions: None
+Note: None
+*/
+Boolean alwaysPreempts( Scheduler *scheduler, PcbType *runningPcb,
+                                                        PcbType *wokenPcb )
+{
+    (void)scheduler;
+    (void)runningPcb;
+    (void)wokenPcb;
+
+    return True;
+}
+
+/*
+Function name: shorterPreempts
+Algorithm: Compares the time remaining of the woken pcb with that of the
+           running pcb, breaking a tie by the lower PID
+Precondition: Given scheduler, running pcb, and pcb just made READY
+Postcondition: Returns True if the woken pcb has less time remaining, or
+               the same time remaining and a lower PID
+Exceptions: None
+Note: O(1); the tie break is the one the time remaining heap uses, so the
+      woken pcb preempts exactly when a fresh pick would choose it
+*/
+Boolean shorterPreempts( Scheduler *scheduler, PcbType *runningPcb,
+                                                        PcbType *wokenPcb )
+{
+    (void)scheduler;
+
+    if( wokenPcb->timeRemaining != runningPcb->timeRemaining )
+    {
+        return wokenPcb->timeRemaining < runningPcb->timeRemaining;
+    }
+
+    return wokenPcb->PID < runningPcb->PID;
+}
+
+/*
+Function name: ignoreTick
+Algorithm: None; for policies that do not account for cycles run
+Precondition: Given scheduler, running pcb, and cycles it just ran
+Postcondition: None
+Exceptions: None
+Note: None
+*/
+void ignoreTick( Scheduler *scheduler, PcbType *pcb, int cycles )
+{
+    (void)scheduler;
+    (void)pcb;
+    (void)cycles;
+}
+
+/*
+Function name: ignorePcb
+Algorithm: None; for policies that do not track a pcb event
+Precondition: Given scheduler and pcb
+Postcondition: None
+Exceptions: None
+Note: None
+*/
+void ignorePcb( Scheduler *scheduler, PcbType *pcb )
+{
+    (void)scheduler;
+    (void)pcb;
+}
+
+/*
+Function name: ignoreReport
+Algorithm: None; for policies with no statistics to log
+Precondition: Given scheduler, config, and output log
+Postcondition: None
+Exceptions: None
+Note: None
+*/
+void ignoreReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog )
+{
+    (void)scheduler;
+    (void)configDataPtr;
+    (void)outputLog;
+}
@@ -0,0 +1,77 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: Scheduler.h
+Brief: Header file for CPU scheduling policy code
+Details: Specifies functions, constants, and other information
+         related to CPU scheduling policy code
+Version: 1.0
+         17 October 2026
+         Initial development of Scheduler code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <limits.h>
+#include "Simulator.h"
+#include "PcbHeap.h"
+#include "PcbRing.h"
+#include "PcbTree.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define DEFAULT_PCB_SHARES 100
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct Scheduler
+{
+    int cpuSchedCode;
+    Boolean preemptive;
+    int quantumCycles;
+    void *policyData;
+    void *sharedData;
+    Boolean ownsShared;
+    void ( *enqueue )( struct Scheduler *scheduler, PcbType *pcb );
+    PcbType *( *pickNext )( struct Scheduler *scheduler );
+    int ( *quantum )( struct Scheduler *scheduler, PcbType *pcb );
+    void ( *onTick )( struct Scheduler *scheduler, PcbType *pcb, int cycles );
+    void ( *onBlock )( struct Scheduler *scheduler, PcbType *pcb );
+    void ( *onWake )( struct Scheduler *scheduler, PcbType *pcb );
+    void ( *onExit )( struct Scheduler *scheduler, PcbType *pcb );
+    void ( *onMigrate )( struct Scheduler *scheduler, PcbType *pcb );
+    Boolean ( *preempts )( struct Scheduler *scheduler, PcbType *runningPcb,
+                                                        PcbType *wokenPcb );
+    void ( *report )( struct Scheduler *scheduler,
+                        ConfigDataType *configDataPtr, OutputType *outputLog );
+    void ( *clearPolicy )( struct Scheduler *scheduler );
+} Scheduler;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+Scheduler *createScheduler( ConfigDataType *configDataPtr, int pcbCount,
+                                                    Scheduler *shareWith );
+Scheduler *clearScheduler( Scheduler *scheduler );
+void heapEnqueue( Scheduler *scheduler, PcbType *pcb );
+PcbType *heapPickNext( Scheduler *scheduler );
+void clearHeapPolicy( Scheduler *scheduler );
+void ringEnqueue( Scheduler *scheduler, PcbType *pcb );
+PcbType *ringPickNext( Scheduler *scheduler );
+void clearRingPolicy( Scheduler *scheduler );
+int getPcbShares( PcbType *pcb );
+int fixedQuantum( Scheduler *scheduler, PcbType *pcb );
+Boolean alwaysPreempts( Scheduler *scheduler, PcbType *runningPcb,
+                                                        PcbType *wokenPcb );
+Boolean shorterPreempts( Scheduler *scheduler, PcbType *runningPcb,
+                                                        PcbType *wokenPcb );
+void ignoreTick( Scheduler *scheduler, PcbType *pcb, int cycles );
+void ignorePcb( Scheduler *scheduler, PcbType *pcb );
+void ignoreReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // SCHEDULER_H
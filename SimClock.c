@@ -0,0 +1,179 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: SimClock.c
+Brief: Implementation file for simulator clock code
+Details: Implements the real-time and virtual-time clocks that the simulator
+         uses to advance and report time
+Version: 1.0
+         17 October 2026
+         Initial development of SimClock code
+Note: Both clocks keep time as integer nanoseconds; times are only turned
+      into strings when they are output
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "SimClock.h"
+#include <errno.h>
+
+const SimTime NSEC_PER_USEC = 1000;
+const SimTime NSEC_PER_MSEC = 1000000;
+const SimTime NSEC_PER_SEC = 1000000000;
+
+static int clockMode = CLOCK_REAL_CODE;
+static SimTime virtualTime = 0;
+static struct timespec realStartTime;
+
+/*
+Function name: setClockMode
+Algorithm: Selects the real-time or virtual-time clock for the simulation
+Precondition: Given clock mode code from the simulator configuration
+Postcondition: Later clock calls use the selected clock
+Exceptions: None
+Note: Must be called before the clock is zeroed
+*/
+void setClockMode( int clockModeCode )
+{
+    clockMode = clockModeCode;
+    virtualTime = 0;
+}
+
+/*
+Function name: accessClock
+Algorithm: Zeroes or reads the selected clock; the real-time clock reads
+           the host monotonic clock relative to when it was zeroed,
+           the virtual clock returns the time it has been advanced to
+Precondition: Given ZERO_TIMER or LAP_TIMER control code
+Postcondition: Returns the current simulation time in nanoseconds
+Exceptions: None
+Note: None
+*/
+SimTime accessClock( int controlCode )
+{
+    struct timespec now;
+
+    if( clockMode == CLOCK_VIRTUAL_CODE )
+    {
+        if( controlCode == ZERO_TIMER )
+        {
+            virtualTime = 0;
+        }
+
+        return virtualTime;
+    }
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    if( controlCode == ZERO_TIMER )
+    {
+        realStartTime = now;
+    }
+
+    return ( now.tv_sec - realStartTime.tv_sec ) * NSEC_PER_SEC
+                                    + ( now.tv_nsec - realStartTime.tv_nsec );
+}
+
+/*
+Function name: runClock
+Algorithm: Lets the given number of milliseconds pass on the clock;
+           the real-time clock spins with runTimer, the virtual clock
+           moves forward without waiting
+Precondition: Given a non-negative number of milliseconds
+Postcondition: Clock has advanced by the given time
+Exceptions: None
+Note: None
+*/
+void runClock( int milliSeconds )
+{
+    if( clockMode == CLOCK_REAL_CODE )
+    {
+        runTimer( milliSeconds );
+    }
+    else
+    {
+        virtualTime += msecToSimTime( milliSeconds );
+    }
+}
+
+/*
+Function name: idleClockUntil
+Algorithm: Called while the CPU is idle with the ending time of the next
+           event; the virtual clock jumps directly to that time, the
+           real-time clock sleeps on an absolute monotonic deadline
+           until that time
+Precondition: Given ending time of the next event
+Postcondition: Clock is at or past the ending time
+Exceptions: None
+Note: Sleeping on an absolute deadline keeps the wake up exact even when
+      the sleep is interrupted and restarted
+*/
+void idleClockUntil( SimTime endingTime )
+{
+    struct timespec deadline;
+
+    if( clockMode == CLOCK_VIRTUAL_CODE )
+    {
+        if( endingTime > virtualTime )
+        {
+            virtualTime = endingTime;
+        }
+        return;
+    }
+
+    simTimeToDeadline( endingTime, &deadline );
+
+    while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME,
+                                            &deadline, NULL ) == EINTR )
+    {
+        // restart the sleep toward the same deadline
+    }
+}
+
+/*
+Function name: simTimeToDeadline
+Algorithm: Converts a real-time simulation time to the matching absolute
+           CLOCK_MONOTONIC time for timed waits
+Precondition: Given simulation time on the real-time clock and a timespec
+Postcondition: Deadline holds the host monotonic time of the given time
+Exceptions: None
+Note: Only meaningful for the real-time clock
+*/
+void simTimeToDeadline( SimTime time, struct timespec *deadline )
+{
+    SimTime deadlineTime;
+
+    deadlineTime = realStartTime.tv_sec * NSEC_PER_SEC
+                                            + realStartTime.tv_nsec + time;
+    deadline->tv_sec = deadlineTime / NSEC_PER_SEC;
+    deadline->tv_nsec = deadlineTime % NSEC_PER_SEC;
+}
+
+/*
+Function name: msecToSimTime
+Algorithm: Converts a millisecond duration to simulation time
+Precondition: Given a number of milliseconds
+Postcondition: Returns the duration in nanoseconds
+Exceptions: None
+Note: None
+*/
+SimTime msecToSimTime( int milliSeconds )
+{
+    return (SimTime)milliSeconds * NSEC_PER_MSEC;
+}
+
+/*
+Function name: simTimeToString
+Algorithm: Formats a simulation time as seconds with microsecond digits,
+           the same format the timer uses
+Precondition: Given a non-negative simulation time and a string with room
+              for the formatted time
+Postcondition: Time string holds the formatted time
+Exceptions: None
+Note: None
+*/
+void simTimeToString( SimTime time, char *timeStr )
+{
+    SimTime microSeconds = time / NSEC_PER_USEC;
+
+    sprintf( timeStr, "%lld.%06lld", (long long)( microSeconds / 1000000 ),
+                                     (long long)( microSeconds % 1000000 ) );
+}
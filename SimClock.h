@@ -0,0 +1,45 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: SimClock.h
+Brief: Header file for simulator clock code
+Details: Specifies functions, constants, and other information
+         related to simulator clock code
+Version: 1.0
+         17 October 2026
+         Initial development of SimClock code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <time.h>
+#include "simtimer.h"
+#include "ConfigAccess.h"
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef int64_t SimTime;  // nanoseconds since the clock was zeroed
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+extern const SimTime NSEC_PER_USEC;
+extern const SimTime NSEC_PER_MSEC;
+extern const SimTime NSEC_PER_SEC;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void setClockMode( int clockModeCode );
+SimTime accessClock( int controlCode );
+void runClock( int milliSeconds );
+void idleClockUntil( SimTime endingTime );
+void simTimeToDeadline( SimTime time, struct timespec *deadline );
+SimTime msecToSimTime( int milliSeconds );
+void simTimeToString( SimTime time, char *timeStr );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // SIM_CLOCK_H
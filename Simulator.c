@@ -11,6 +11,8 @@ Note:
 
 // Header Files ///////////////////////////////////////////////////
 #include "Simulator.h"
+#include "Scheduler.h"
+#include "MultiCore.h"
 
 /*
 Function name: runSimulator
@@ -24,586 +26,511 @@ Note: None
 */
 int runSimulator( ConfigDataType *configDataPtr, OpCodeType *mdData )
 {
-    PcbType *pcbQueue = NULL, *pcbQueueStart, *tempPcbQueue, *currentPcb;
+    PcbType *pcbQueue = NULL, *tempPcbQueue, *currentPcb;
+    Scheduler *scheduler;
+    OverheadType overhead;
+    PcbType *lastPcb = NULL;
+    PcbStateLists pcbStates;
+    PcbTable *pcbTable;
     OpCodeType *currentOpCode;
     OutputType *outputLog = NULL;
     MMU *memory = NULL;
-    int initializePcbsResult, writeOutputLogToFileResult, *opTime;
-    int segment, base, offset, memCommand, memRemaining, quantum;
-    float currentTime, endingTime;
-    char displayString[ STD_STR_LEN ], time[ STD_STR_LEN ];
+    PagingType *paging = NULL;
+    int initializePcbsResult, writeOutputLogToFileResult;
+    int memRemaining, quantum, cycles, ioTime, batchCount = 0;
+    int preemptIndex = 0, stallTime;
+    SimTime currentTime, endingTime, faultEnd;
+    char displayString[ STD_STR_LEN ];
     char stateStr[ STD_STR_LEN ];
-    pthread_t threadID;
-    Interrupt *interruptQueue;
+    InterruptQueue *interruptQueue;
+    Interrupt *pendingInterrupt;
+    DeviceManager *devices;
+    DeviceRequest deviceRequest, *ioRequest;
+    DeviceClass deviceClass;
+    Boolean asyncDevices, opStarted;
+    char *ioType;
 
     if( configDataPtr->logToCode == LOGTO_FILE_CODE
         || configDataPtr->logToCode == LOGTO_BOTH_CODE )
     {
-        outputLog = (OutputType *)malloc( sizeof( OutputType ) );
+        outputLog = createOutputLog();
     }
 
-    memRemaining = configDataPtr->memAvailable;
+    memRemaining = findMemoryCapacity( configDataPtr );
+    setClockMode( configDataPtr->clockModeCode );
+    devices = startDevices();
+    interruptQueue = createInterruptQueue( DEFAULT_INTERRUPT_CAPACITY,
+            configDataPtr->interruptQueueCode == INTERRUPT_QUEUE_WHEEL_CODE );
+    asyncDevices = configDataPtr->clockModeCode == CLOCK_REAL_CODE;
 
     outputLine( configDataPtr, outputLog, "================\n" );
     outputLine( configDataPtr, outputLog, "Begin Simulation\n\n" );
 
-    accessTimer( ZERO_TIMER, time );
-    sprintf( displayString, " %s, OS: System Start\n", time );
-    outputLine( configDataPtr, outputLog, displayString );
+    currentTime = accessClock( ZERO_TIMER );
+    outputEvent( configDataPtr, outputLog, currentTime, "OS: System Start\n" );
 
-    accessTimer( LAP_TIMER, time );
-    sprintf( displayString, " %s, OS: Create Process Control Blocks\n", time );
-    outputLine( configDataPtr, outputLog, displayString );
+    currentTime = accessClock( LAP_TIMER );
+    outputEvent( configDataPtr, outputLog, currentTime,
+                                        "OS: Create Process Control Blocks\n" );
     initializePcbsResult = initializePcbs(configDataPtr, mdData, &pcbQueue);
 
     if( initializePcbsResult == NO_ERR )
     {
-        accessTimer( LAP_TIMER, time );
-        sprintf( displayString,
-                " %s, OS: All processes initialized in New state\n", time );
-        outputLine( configDataPtr, outputLog, displayString );
+        currentTime = accessClock( LAP_TIMER );
+        outputEvent( configDataPtr, outputLog, currentTime,
+                               "OS: All processes initialized in New state\n" );
     }
     else
     {
         clearPcbQueue( pcbQueue );
+        interruptQueue = clearInterruptQueue( interruptQueue );
+        devices = stopDevices( devices );
         return initializePcbsResult;
     }
 
     setAllPcbStates( pcbQueue, READY );
-    accessTimer( LAP_TIMER, time );
-    sprintf( displayString,
-                " %s, OS: All processes now set in Ready state\n", time );
-    outputLine( configDataPtr, outputLog, displayString );
+    initPcbStates( &pcbStates, pcbQueue );
+    pcbTable = createPcbTable( pcbQueue );
+    currentTime = accessClock( LAP_TIMER );
+    outputEvent( configDataPtr, outputLog, currentTime,
+                                 "OS: All processes now set in Ready state\n" );
 
-    pcbQueueStart = pcbQueue;
+    scheduler = createScheduler( configDataPtr, pcbTable->size, NULL );
+    initOverhead( &overhead );
 
-    // Run Simulator without preemption
-    if( configDataPtr->cpuSchedCode == CPU_SCHED_SJF_N_CODE ||
-        configDataPtr->cpuSchedCode == CPU_SCHED_FCFS_N_CODE )
+    for( tempPcbQueue = pcbQueue; tempPcbQueue != NULL;
+                                            tempPcbQueue = tempPcbQueue->next )
     {
-        while( pcbQueue != NULL )
-        {
-            pcbQueue = sortPCB( pcbQueue, configDataPtr->cpuSchedCode );
-            accessTimer( LAP_TIMER, time );
-            sprintf( displayString,
-                " %s, OS: Process %d selected with %d ms remaining\n",
-                time, pcbQueue->PID, pcbQueue->timeRemaining );
-            outputLine( configDataPtr, outputLog, displayString );
-
-            pcbQueue->state = RUNNING;
-            accessTimer( LAP_TIMER, time );
-            pcbStateToString( pcbQueue->state, stateStr );
-            sprintf( displayString,
-                " %s, OS: Process %d set in %s state\n\n",
-                time, pcbQueue->PID, stateStr );
-            outputLine( configDataPtr, outputLog, displayString );
-
-            currentOpCode = pcbQueue->programCounter;
-            while( currentOpCode != NULL )
-            {
-                accessTimer( LAP_TIMER, time );
-                if( currentOpCode->opLtr == 'P'
-                    || currentOpCode->opLtr == 'O'
-                    || currentOpCode->opLtr == 'I' )
-                {
-                    opTime = (int *)malloc( sizeof( int ) );
-                    if( currentOpCode->opLtr == 'P' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s operation start\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        *opTime = configDataPtr->procCycleRate *
-                                                        currentOpCode->opValue;
-                    }
-                    else if( currentOpCode->opLtr == 'I' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s input start\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        *opTime = configDataPtr->ioCycleRate *
-                                                        currentOpCode->opValue;
-                    }
-                    else if( currentOpCode->opLtr == 'O' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s output start\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        *opTime = configDataPtr->ioCycleRate *
-                                                        currentOpCode->opValue;
-                    }
-
-                    outputLine( configDataPtr, outputLog, displayString );
-                    pthread_create( &threadID, NULL,
-                                    simulateOperation, (void *)opTime );
-                    pthread_join( threadID, NULL );
-                    free( opTime );
-
-                    accessTimer( LAP_TIMER, time );
-                    if( currentOpCode->opLtr == 'P' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s operation end\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
-                    }
-                    else if( currentOpCode->opLtr == 'O' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s output end\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
-                    }
-                    else if( currentOpCode->opLtr == 'I' )
-                    {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s input end\n",
-                            time, pcbQueue->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
-                    }
-                }
-                else if( currentOpCode->opLtr == 'M' )
-                {
-                    memCommand = currentOpCode->opValue;
-                    segment = (int)( memCommand / SEG_OFFSET );
-                    base = (int)( memCommand % SEG_OFFSET) / BASE_OFFSET;
-                    offset = (int)( memCommand % SEG_OFFSET) % BASE_OFFSET;
-
-                    sprintf( displayString,
-                        " %s, Process: %d, MMU attempt to %s %d/%d/%d\n",
-                        time, pcbQueue->PID, currentOpCode->opName,
-                        segment, base, offset);
-                    outputLine( configDataPtr, outputLog, displayString );
-
-                    if( compareString( currentOpCode->opName , "allocate") == 0)
-                    {
-                        if ( isValidAllocate( memory, base, offset ) &&
-                                                        offset <= memRemaining )
-                        {
-                            memory = addMem(memory, pcbQueue->PID, segment,
-                                                                base, offset);
-                            memRemaining -= offset;
-
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU successful %s\n",
-                                time, pcbQueue->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-                        }
-                        else
-                        {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU failed to %s\n\n",
-                                time, pcbQueue->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                             " %s, OS: Process %d experiences segmentation fault\n",
-                             time, pcbQueue->PID );
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-                            break;
-                        }
-                    }
-                    else if
-                        ( compareString( currentOpCode->opName , "access") == 0)
-                    {
-                        if ( isValidAccess( memory, pcbQueue->PID, segment,
-                                                                base, offset ) )
-                        {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU successful %s\n",
-                                time, pcbQueue->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-                        }
-                        else
-                        {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU failed to %s\n\n",
-                                time, pcbQueue->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                             " %s, OS: Process %d experiences segmentation fault\n",
-                             time, pcbQueue->PID );
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-                            break;
-                        }
-                    }
-                }
-                else if ( currentOpCode->opLtr == 'A' )
-                {
-                    outputLine( configDataPtr, outputLog, "\n" );
-                    break;
-                }
-                currentOpCode = currentOpCode->next;
-            }
+        scheduler->enqueue( scheduler, tempPcbQueue );
+    }
 
-            pcbQueue->state = EXIT;
-            accessTimer( LAP_TIMER, time );
-            memory = clearMMU( memory );
-            memRemaining = configDataPtr->memAvailable;
-            pcbStateToString( pcbQueue->state, stateStr );
-            sprintf( displayString,
-                " %s, OS: Process %d ended and set in %s state\n",
-                time, pcbQueue->PID, stateStr );
-            outputLine( configDataPtr, outputLog, displayString );
-            pcbQueue = pcbQueue->next;
-        }
+    if( configDataPtr->cpuCores > 1 && asyncDevices == False )
+    {
+        currentTime = accessClock( LAP_TIMER );
+        outputEvent( configDataPtr, outputLog, currentTime,
+                            "OS: Virtual clock simulates a single CPU core\n" );
+    }
 
-        pcbQueueStart = clearPcbQueue( pcbQueueStart );
+    // Run simulator on multiple cores
+    if( configDataPtr->cpuCores > 1 && asyncDevices == True )
+    {
+        runMultiCore( configDataPtr, outputLog, devices, pcbQueue, pcbTable );
     }
 
-    // Run simulator with preemption
-    else if ( configDataPtr->cpuSchedCode == CPU_SCHED_SRTF_P_CODE ||
-              configDataPtr->cpuSchedCode == CPU_SCHED_FCFS_P_CODE ||
-              configDataPtr->cpuSchedCode == CPU_SCHED_RR_P_CODE )
+    // Run simulator on one core
+    else
     {
-        interruptQueue = NULL;
+        if( configDataPtr->pagingCode != PAGING_OFF_CODE )
+        {
+            paging = createPaging( configDataPtr, pcbTable->size );
+        }
 
-        while( checkIfEnded( pcbQueue ) == False )
+        while( checkIfEnded( &pcbStates ) == False )
         {
-            if( checkIfIdle( pcbQueue ) )
+            if( checkIfIdle( &pcbStates ) )
             {
-                accessTimer( LAP_TIMER, time );
-                sprintf( displayString, " %s, OS: System/CPU idle\n", time );
-                outputLine( configDataPtr, outputLog, displayString );
+                currentTime = accessClock( LAP_TIMER );
+                outputEvent( configDataPtr, outputLog, currentTime,
+                                                      "OS: System/CPU idle\n" );
 
-                while( checkIfIdle( pcbQueue ) )
+                while( checkIfIdle( &pcbStates ) )
                 {
-                    accessTimer( LAP_TIMER, time );
-                    currentTime = stringToFloat( time );
-
-                    while( haveInterrupt( interruptQueue, currentTime ) )
+                    if( asyncDevices == True
+                                    && peekInterrupt( interruptQueue ) == NULL )
                     {
-                        accessTimer( LAP_TIMER, time );
-                        sprintf( displayString,
-                            " %s, OS: Interrupt called by process %d\n\n",
-                            time, interruptQueue->PID );
-                        outputLine( configDataPtr, outputLog, displayString );
+                        awaitDeviceCompletion( devices );
+                    }
 
-                        accessTimer( LAP_TIMER, time );
-                        sprintf( displayString,
-                            " %s, Process: %d, %s %s end\n\n",
-                            time, interruptQueue->PID,
-                            interruptQueue->opName,
-                            interruptQueue->opType );
-                        outputLine( configDataPtr, outputLog, displayString );
-
-                        tempPcbQueue = pcbQueue;
-                        while( tempPcbQueue != NULL )
-                        {
-                            if( tempPcbQueue->PID == interruptQueue->PID )
-                            {
-                                tempPcbQueue->state = READY;
-                                break;
-                            }
-                            tempPcbQueue = tempPcbQueue->next;
-                        }
+                    interruptQueue = deliverDeviceCompletions( devices,
+                                                            interruptQueue );
+                    pendingInterrupt = peekInterrupt( interruptQueue );
+                    if( pendingInterrupt != NULL )
+                    {
+                        idleClockUntil( pendingInterrupt->endingTime );
+                    }
 
-                        accessTimer( LAP_TIMER, time );
-                        sprintf( displayString,
-                            " %s, OS: Process %d set in Ready state\n",
-                            time, interruptQueue->PID );
-                        outputLine( configDataPtr, outputLog, displayString );
+                    currentTime = accessClock( LAP_TIMER );
 
-                        interruptQueue = removeInterupt( &interruptQueue );
-                        accessTimer( LAP_TIMER, time );
-                        currentTime = stringToFloat( time );
-                    }
+                    batchCount = takeInterruptBatch( configDataPtr,
+                                interruptQueue, currentTime, &overhead );
+                    wakeInterruptBatch( configDataPtr, outputLog, &pcbStates,
+                                pcbTable, scheduler, interruptQueue,
+                                                        batchCount, True );
+                    batchCount = 0;
                 }
             }
 
-            pcbQueue = sortPCB( pcbQueue, configDataPtr->cpuSchedCode );
-            currentPcb = getNextPcb( pcbQueue, READY );
+            currentPcb = scheduler->pickNext( scheduler );
+            chargeOverhead( configDataPtr->decisionCost, &overhead.decisions );
+
+            if( currentPcb != lastPcb )
+            {
+                chargeOverhead( configDataPtr->switchCost,
+                                                &overhead.contextSwitches );
+                lastPcb = currentPcb;
+            }
 
-            accessTimer( LAP_TIMER, time );
+            currentTime = accessClock( LAP_TIMER );
             sprintf( displayString,
-                " %s, OS: Process %d selected with %d ms remaining\n",
-                time, currentPcb->PID, currentPcb->timeRemaining );
-            outputLine( configDataPtr, outputLog, displayString );
+                "OS: Process %d selected with %d ms remaining\n",
+                currentPcb->PID, currentPcb->timeRemaining );
+            outputEvent( configDataPtr, outputLog, currentTime, displayString );
 
-            currentPcb->state = RUNNING;
-            accessTimer( LAP_TIMER, time );
+            setPcbState( &pcbStates, currentPcb, RUNNING );
+            currentTime = accessClock( LAP_TIMER );
             pcbStateToString( currentPcb->state, stateStr );
             sprintf( displayString,
-                " %s, OS: Process %d set in %s state\n\n",
-                time, currentPcb->PID, stateStr );
-            outputLine( configDataPtr, outputLog, displayString );
+                "OS: Process %d set in %s state\n\n",
+                currentPcb->PID, stateStr );
+            outputEvent( configDataPtr, outputLog, currentTime, displayString );
 
-            quantum = configDataPtr->quantumCycles;
+            quantum = scheduler->quantum( scheduler, currentPcb );
+            opStarted = False;
 
-            while( quantum > 0 && currentPcb->programCounter != NULL &&
-                currentPcb->timeRemaining > 0 )
+            while( currentPcb->state == RUNNING && quantum > 0
+                && currentPcb->programCounter != NULL
+                && ( currentPcb->timeRemaining > 0
+                                        || scheduler->preemptive == False ) )
             {
-                accessTimer( LAP_TIMER, time );
+                currentTime = accessClock( LAP_TIMER );
                 currentOpCode = currentPcb->programCounter;
 
                 if( currentOpCode->opLtr == 'O'
                     || currentOpCode->opLtr == 'I' )
                 {
-
-                    currentTime = stringToFloat( time );
-                    endingTime = configDataPtr->ioCycleRate * currentOpCode->opValue * 0.001;
-                    currentPcb->timeRemaining -= configDataPtr->ioCycleRate * currentOpCode->opValue;
-                    endingTime += currentTime;
+                    ioTime = configDataPtr->ioCycleRate * currentOpCode->opValue;
+                    currentPcb->timeRemaining -= ioTime;
+                    currentPcb->programCounter =
+                                            currentPcb->programCounter->next;
 
                     if( currentOpCode->opLtr == 'I' )
+                    {
+                        ioType = "input";
+                    }
+                    else
+                    {
+                        ioType = "output";
+                    }
 
+                    if( scheduler->preemptive == False )
                     {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s input start\n\n",
-                            time, currentPcb->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
+                        sprintf( displayString, "Process: %d, %s %s start\n",
+                            currentPcb->PID, currentOpCode->opName, ioType );
+                        outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
 
-                        interruptQueue = addInterrupt( interruptQueue,
-                            currentPcb->PID, "input",
-                            currentOpCode->opName , endingTime );
+                        deviceRequest.PID = currentPcb->PID;
+                        deviceRequest.isAsync = False;
+                        deviceRequest.milliSeconds = ioTime;
+                        deviceClass = getDeviceClass( currentOpCode );
+                        submitDeviceOp( devices, deviceClass, &deviceRequest );
+                        awaitDeviceOp( devices, deviceClass, &deviceRequest );
+
+                        currentTime = accessClock( LAP_TIMER );
+                        sprintf( displayString, "Process: %d, %s %s end\n",
+                            currentPcb->PID, currentOpCode->opName, ioType );
+                        outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
+                        continue;
+                    }
+
+                    endingTime = currentTime + msecToSimTime( ioTime );
+                    sprintf( displayString, "Process: %d, %s %s start\n\n",
+                            currentPcb->PID, currentOpCode->opName, ioType );
+                    outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
 
+                    if( asyncDevices == True )
+                    {
+                        ioRequest = (DeviceRequest *)malloc(
+                                                    sizeof( DeviceRequest ) );
+                        ioRequest->PID = currentPcb->PID;
+                        ioRequest->milliSeconds = ioTime;
+                        ioRequest->isAsync = True;
+                        ioRequest->endingTime = endingTime;
+                        ioRequest->opType = ioType;
+                        ioRequest->opName = currentOpCode->opName;
+                        submitDeviceOp( devices,
+                                getDeviceClass( currentOpCode ), ioRequest );
                     }
-                    else if( currentOpCode->opLtr == 'O' )
+                    else
                     {
-                        sprintf( displayString,
-                            " %s, Process: %d, %s output start\n\n",
-                            time, currentPcb->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
-
                         interruptQueue = addInterrupt( interruptQueue,
-                            currentPcb->PID, "input",
-                            currentOpCode->opName , endingTime );
+                            currentPcb->PID, ioType,
+                            currentOpCode->opName, endingTime );
                     }
 
-                    currentPcb->programCounter =
-                                            currentPcb->programCounter->next;
-                    currentPcb->state = BLOCKED;
-                    break;
+                    setPcbState( &pcbStates, currentPcb, BLOCKED );
+                    scheduler->onBlock( scheduler, currentPcb );
                 }
                 else if( currentOpCode->opLtr == 'P')
                 {
-                    if( quantum == configDataPtr->quantumCycles)
+                    if( opStarted == False )
                     {
                         sprintf( displayString,
-                            " %s, Process: %d, %s operation start\n",
-                            time, currentPcb->PID, currentOpCode->opName );
-                        outputLine( configDataPtr, outputLog, displayString );
+                            "Process: %d, %s operation start\n",
+                            currentPcb->PID, currentOpCode->opName );
+                        outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
+                        opStarted = True;
                     }
 
-                    runTimer( configDataPtr->procCycleRate );
-                    currentOpCode->opValue--;
-                    currentPcb->timeRemaining -= configDataPtr->procCycleRate;
-                    quantum--;
+                    cycles = countRunCycles( configDataPtr, devices,
+                            interruptQueue, currentTime, quantum,
+                                                    currentOpCode->opValue );
+                    runClock( configDataPtr->procCycleRate * cycles );
+                    currentOpCode->opValue -= cycles;
+                    currentPcb->timeRemaining -=
+                                        configDataPtr->procCycleRate * cycles;
+                    quantum -= cycles;
+                    scheduler->onTick( scheduler, currentPcb, cycles );
 
                     if( currentOpCode->opValue == 0 )
                     {
                         currentPcb->programCounter =
                                             currentPcb->programCounter->next;
-                        break;
+                        opStarted = False;
 
+                        if( scheduler->preemptive == True )
+                        {
+                            break;
+                        }
+
+                        currentTime = accessClock( LAP_TIMER );
+                        sprintf( displayString,
+                            "Process: %d, %s operation end\n",
+                            currentPcb->PID, currentOpCode->opName );
+                        outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
                     }
-                    accessTimer( LAP_TIMER, time );
-                    currentTime = stringToFloat( time );
-                    if( haveInterrupt( interruptQueue, currentTime ) )
+                    else
                     {
-                        break;
-                    }
-                }
-                else if( currentOpCode->opLtr == 'M' )
-                {
-                    memCommand = currentOpCode->opValue;
-                    segment = (int)( memCommand / SEG_OFFSET );
-                    base = (int)( memCommand % SEG_OFFSET) / BASE_OFFSET;
-                    offset = (int)( memCommand % SEG_OFFSET) % BASE_OFFSET;
+                        currentTime = accessClock( LAP_TIMER );
+                        interruptQueue = deliverDeviceCompletions( devices,
+                                                            interruptQueue );
 
-                    sprintf( displayString,
-                        " %s, Process: %d, MMU attempt to %s %d/%d/%d\n",
-                        time, currentPcb->PID, currentOpCode->opName,
-                        segment, base, offset);
-                    outputLine( configDataPtr, outputLog, displayString );
+                        batchCount = takeInterruptBatch( configDataPtr,
+                                interruptQueue, currentTime, &overhead );
 
-                    if( compareString( currentOpCode->opName , "allocate") == 0)
-                    {
-                        if ( isValidAllocate( memory, base, offset ) &&
-                                                        offset <= memRemaining )
+                        if( batchCount > 0 )
                         {
-                            memory = addMem(memory, currentPcb->PID, segment,
-                                                                base, offset);
-                            memRemaining -= offset;
+                            preemptIndex = batchPreempts( scheduler, pcbTable,
+                                    interruptQueue, batchCount, currentPcb );
+
+                            if( preemptIndex != NO_PREEMPTION )
+                            {
+                                break;
+                            }
+
+                            outputLine( configDataPtr, outputLog, "\n" );
+                            wakeInterruptBatch( configDataPtr, outputLog,
+                                        &pcbStates, pcbTable, scheduler,
+                                            interruptQueue, batchCount, True );
+                            batchCount = 0;
 
-                            accessTimer( LAP_TIMER, time );
+                            currentTime = accessClock( LAP_TIMER );
                             sprintf( displayString,
-                                " %s, Process: %d, MMU successful %s\n",
-                                time, currentPcb->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
+                                "OS: Process %d keeps the CPU\n\n",
+                                currentPcb->PID );
+                            outputEvent( configDataPtr, outputLog, currentTime,
                                                                 displayString );
-                            currentPcb->programCounter = currentPcb->programCounter->next;
                         }
-                        else
-                        {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU failed to %s\n\n",
-                                time, currentPcb->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
+                    }
+                }
+                else if( currentOpCode->opLtr == 'M' )
+                {
+                    if( simulateMemoryOp( configDataPtr, outputLog, &memory,
+                                    &memRemaining, paging, currentPcb->PID,
+                            currentOpCode, &stallTime, &faultEnd ) == True )
+                    {
+                        currentPcb->programCounter =
+                                            currentPcb->programCounter->next;
+                    }
+                    else
+                    {
+                        setPcbState( &pcbStates, currentPcb, EXIT );
+                    }
+
+                    if( stallTime > 0 )
+                    {
+                        runClock( stallTime );
+                    }
+
+                    if( faultEnd > 0 && scheduler->preemptive == False )
+                    {
+                        currentTime = accessClock( LAP_TIMER );
+                        sprintf( displayString,
+                            "Process: %d, swap page-in start\n",
+                                                            currentPcb->PID );
+                        outputEvent( configDataPtr, outputLog, currentTime,
                                                                 displayString );
 
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                             " %s, OS: Process %d experiences segmentation fault\n",
-                             time, currentPcb->PID );
-                            outputLine( configDataPtr, outputLog,
+                        deviceRequest.PID = currentPcb->PID;
+                        deviceRequest.isAsync = False;
+                        deviceRequest.milliSeconds =
+                            (int)( ( faultEnd - currentTime ) / NSEC_PER_MSEC );
+                        submitDeviceOp( devices, SWAP_DEVICE, &deviceRequest );
+                        awaitDeviceOp( devices, SWAP_DEVICE, &deviceRequest );
+
+                        currentTime = accessClock( LAP_TIMER );
+                        sprintf( displayString,
+                            "Process: %d, swap page-in end\n",
+                                                            currentPcb->PID );
+                        outputEvent( configDataPtr, outputLog, currentTime,
                                                                 displayString );
-                            currentPcb->state = EXIT;
-                            break;
-                        }
                     }
-                    else if
-                        ( compareString( currentOpCode->opName , "access") == 0)
+                    else if( faultEnd > 0 )
                     {
-                        if ( isValidAccess( memory, currentPcb->PID, segment,
-                                                                base, offset ) )
-                        {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU successful %s\n",
-                                time, currentPcb->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
+                        currentTime = accessClock( LAP_TIMER );
+                        sprintf( displayString,
+                            "Process: %d, swap page-in start\n\n",
+                                                            currentPcb->PID );
+                        outputEvent( configDataPtr, outputLog, currentTime,
                                                                 displayString );
-                            currentPcb->programCounter = currentPcb->programCounter->next;
+
+                        if( asyncDevices == True )
+                        {
+                            ioRequest = (DeviceRequest *)malloc(
+                                                    sizeof( DeviceRequest ) );
+                            ioRequest->PID = currentPcb->PID;
+                            ioRequest->milliSeconds = (int)( ( faultEnd
+                                            - currentTime ) / NSEC_PER_MSEC );
+                            ioRequest->isAsync = True;
+                            ioRequest->endingTime = faultEnd;
+                            ioRequest->opType = "page-in";
+                            ioRequest->opName = "swap";
+                            submitDeviceOp( devices, SWAP_DEVICE, ioRequest );
                         }
                         else
                         {
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                                " %s, Process: %d, MMU failed to %s\n\n",
-                                time, currentPcb->PID, currentOpCode->opName);
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-
-                            accessTimer( LAP_TIMER, time );
-                            sprintf( displayString,
-                             " %s, OS: Process %d experiences segmentation fault\n",
-                             time, currentPcb->PID );
-                            outputLine( configDataPtr, outputLog,
-                                                                displayString );
-
-                            currentPcb->state = EXIT;
-                            break;
+                            interruptQueue = addInterrupt( interruptQueue,
+                                currentPcb->PID, "page-in", "swap", faultEnd );
                         }
+
+                        setPcbState( &pcbStates, currentPcb, BLOCKED );
+                        scheduler->onBlock( scheduler, currentPcb );
                     }
                 }
                 else if ( currentOpCode->opLtr == 'A' )
                 {
-                    currentPcb->state = EXIT;
+                    setPcbState( &pcbStates, currentPcb, EXIT );
                     outputLine( configDataPtr, outputLog, "\n" );
-                    break;
                 }
             }
 
+            interruptQueue = deliverDeviceCompletions( devices,
+                                                            interruptQueue );
             if( currentPcb->state == BLOCKED )
             {
-                accessTimer( LAP_TIMER, time );
+                currentTime = accessClock( LAP_TIMER );
                 sprintf( displayString,
-                    " %s, OS: Process %d set in BLOCKED state\n",
-                    time, currentPcb->PID);
-                outputLine( configDataPtr, outputLog, displayString );
+                    "OS: Process %d set in BLOCKED state\n",
+                    currentPcb->PID);
+                outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
             }
             else if( currentPcb->state == EXIT ||
                 currentPcb->timeRemaining == 0)
             {
-                currentPcb->state = EXIT ;
-                accessTimer( LAP_TIMER, time );
+                setPcbState( &pcbStates, currentPcb, EXIT );
+                scheduler->onExit( scheduler, currentPcb );
+
+                if( scheduler->preemptive == False )
+                {
+                    memory = clearMMU( memory );
+                    memRemaining = findMemoryCapacity( configDataPtr );
+                }
+
+                if( paging != NULL )
+                {
+                    releasePages( paging, currentPcb->PID );
+                }
+
+                currentTime = accessClock( LAP_TIMER );
                 sprintf( displayString,
-                    " %s, OS: Process %d ended and set in EXIT state\n",
-                    time, currentPcb->PID);
-                outputLine( configDataPtr, outputLog, displayString );
+                    "OS: Process %d ended and set in EXIT state\n",
+                    currentPcb->PID);
+                outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
             }
-            else if( haveInterrupt( interruptQueue, currentTime ) )
+            else
             {
-                accessTimer( LAP_TIMER, time );
-                currentTime = stringToFloat( time );
-
-                while( haveInterrupt( interruptQueue, currentTime ) )
+                // at the end of a quantum the first interrupt due is named
+                if( batchCount == 0 )
                 {
-                    accessTimer( LAP_TIMER, time );
-                    sprintf( displayString,
-                        "\n %s, OS: Process %d interrupted by process %d\n",
-                        time, currentPcb->PID, interruptQueue->PID );
-                    outputLine( configDataPtr, outputLog, displayString );
-
-                    if( currentPcb->state != READY )
-                    {
-                        currentPcb->state = READY;
-                        accessTimer( LAP_TIMER, time );
-                        sprintf( displayString,
-                            " %s, OS: Process %d set in READY state\n\n",
-                            time, interruptQueue->PID );
-                        outputLine( configDataPtr, outputLog, displayString );
-                    }
+                    batchCount = takeInterruptBatch( configDataPtr,
+                                    interruptQueue, currentTime, &overhead );
+                    preemptIndex = 0;
+                }
 
-                    accessTimer( LAP_TIMER, time );
+                if( batchCount > 0 )
+                {
+                    currentTime = accessClock( LAP_TIMER );
+                    outputLine( configDataPtr, outputLog, "\n" );
                     sprintf( displayString,
-                        " %s, Process: %d, %s %s end\n\n",
-                        time, interruptQueue->PID,
-                        interruptQueue->opName,
-                        interruptQueue->opType );
-                    outputLine( configDataPtr, outputLog, displayString );
-
-                    tempPcbQueue = pcbQueue;
-                    while( tempPcbQueue != NULL )
-                    {
-                        if( tempPcbQueue->PID == interruptQueue->PID )
-                        {
-                            tempPcbQueue->state = READY;
-                            break;
-                        }
-                        tempPcbQueue = tempPcbQueue->next;
-                    }
+                        "OS: Process %d interrupted by process %d\n",
+                        currentPcb->PID,
+                        interruptQueue->batch[ preemptIndex ].PID );
+                    outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
 
-                    accessTimer( LAP_TIMER, time );
+                    setPcbState( &pcbStates, currentPcb, READY );
+                    scheduler->enqueue( scheduler, currentPcb );
                     sprintf( displayString,
-                        " %s, OS: Process %d set in READY state\n",
-                        time, interruptQueue->PID );
-                    outputLine( configDataPtr, outputLog, displayString );
+                        "OS: Process %d set in READY state\n\n",
+                        currentPcb->PID );
+                    outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
 
-                    interruptQueue = removeInterupt(&interruptQueue);
-                    accessTimer( LAP_TIMER, time );
-                    currentTime = stringToFloat( time );
+                    wakeInterruptBatch( configDataPtr, outputLog, &pcbStates,
+                                pcbTable, scheduler, interruptQueue,
+                                                        batchCount, False );
+                    batchCount = 0;
                 }
             }
+
+            if( batchCount > 0 )
+            {
+                wakeInterruptBatch( configDataPtr, outputLog, &pcbStates,
+                                pcbTable, scheduler, interruptQueue,
+                                                        batchCount, True );
+                batchCount = 0;
+            }
+
             if( currentPcb->state == RUNNING)
             {
-                currentPcb->state = READY;
-                accessTimer( LAP_TIMER, time );
+                setPcbState( &pcbStates, currentPcb, READY );
+                scheduler->enqueue( scheduler, currentPcb );
+                currentTime = accessClock( LAP_TIMER );
                 sprintf( displayString,
-                    " %s, Process: %d, %s operation end\n\n",
-                    time, currentPcb->PID, currentOpCode->opName );
-                outputLine( configDataPtr, outputLog, displayString );
+                    "Process: %d, %s operation end\n\n",
+                    currentPcb->PID, currentOpCode->opName );
+                outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
 
-                accessTimer( LAP_TIMER, time );
+                currentTime = accessClock( LAP_TIMER );
                 sprintf( displayString,
-                    " %s, OS: Process %d set in READY state\n",
-                    time, currentPcb->PID);
-                outputLine( configDataPtr, outputLog, displayString );
+                    "OS: Process %d set in READY state\n",
+                    currentPcb->PID);
+                outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
             }
         }
+
+        scheduler->report( scheduler, configDataPtr, outputLog );
+        reportOverhead( configDataPtr, outputLog, &overhead );
+        reportPaging( configDataPtr, outputLog, paging );
     }
 
-    pcbQueue = sortPCB( pcbQueue, configDataPtr->cpuSchedCode );
+    scheduler = clearScheduler( scheduler );
+    pcbTable = clearPcbTable( pcbTable );
     pcbQueue = clearPcbQueue( pcbQueue );
     interruptQueue = clearInterruptQueue( interruptQueue );
     memory = clearMMU( memory );
-    accessTimer( LAP_TIMER, time );
-    sprintf( displayString, " %s, OS: System stop\n\n", time );
-    outputLine( configDataPtr, outputLog, displayString );
+    paging = clearPaging( paging );
+    devices = stopDevices( devices );
+    currentTime = accessClock( LAP_TIMER );
+    outputEvent( configDataPtr, outputLog, currentTime, "OS: System stop\n\n" );
     outputLine( configDataPtr, outputLog, "End Simulation - Complete\n");
     outputLine( configDataPtr, outputLog, "=========================\n");
 
@@ -620,6 +547,495 @@ int runSimulator( ConfigDataType *configDataPtr, OpCodeType *mdData )
     return 0;
 }
 
+/*
+Function name: simulateMemoryOp
+Algorithm: Decodes the segment, base, and offset of an M op code, then
+           checks the MMU table and either records the allocation or
+           validates the access, logging the attempt and its result; with
+           paging an allocation also maps its pages to frames and an access
+           is translated through the TLB, a miss costing the TLB miss and
+           page walk time; under demand paging an access to a page on the
+           swap device loads it and queues the transfer, and the transfer
+           of any page it evicts, on the swap device after that time
+Precondition: Given config, output log, MMU table, memory remaining, paging
+              data or NULL when paging is off, PID, an M op code, and stall
+              time and fault end result pointers
+Postcondition: Returns True if the MMU request succeeded; on success an
+               allocation is added to the MMU table and memory remaining is
+               reduced; on failure a segmentation fault is logged; stall
+               time holds the milliseconds the CPU spends on a TLB miss, or
+               zero; fault end holds the time the swap device finishes a
+               page fault, or zero if there was none
+Exceptions: None
+Note: An allocation fails when there are not enough free frames for its
+      pages, the same as when memory remaining runs out; the caller runs
+      the clock for the stall time, after giving up any lock it holds on
+      the memory tables, and blocks the process until a page fault ends
+*/
+Boolean simulateMemoryOp( ConfigDataType *configDataPtr, OutputType *outputLog,
+    MMU **memory, int *memRemaining, PagingType *paging, int procID,
+                OpCodeType *opCode, int *stallTime, SimTime *faultEnd )
+{
+    int segment, base, offset, memCommand, frame, victimPID, victimVpn;
+    Boolean success = False, pageFault = False;
+    char displayString[ STD_STR_LEN ];
+
+    *stallTime = 0;
+    *faultEnd = 0;
+
+    memCommand = opCode->opValue;
+    segment = (int)( memCommand / SEG_OFFSET );
+    base = (int)( memCommand % SEG_OFFSET) / BASE_OFFSET;
+    offset = (int)( memCommand % SEG_OFFSET) % BASE_OFFSET;
+
+    sprintf( displayString, "Process: %d, MMU attempt to %s %d/%d/%d\n",
+                            procID, opCode->opName, segment, base, offset );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+
+    if( compareString( opCode->opName , "allocate") == 0)
+    {
+        if ( isValidAllocate( *memory, procID, segment, base, offset ) &&
+                                                    offset <= *memRemaining
+            && ( paging == NULL
+                    || mapPages( paging, procID, segment, base, offset ) ) )
+        {
+            *memory = addMem( *memory, procID, segment, base, offset );
+            *memRemaining -= offset;
+            success = True;
+        }
+    }
+    else if( compareString( opCode->opName , "access") == 0)
+    {
+        success = isValidAccess( *memory, procID, segment, base, offset );
+
+        if( success == True && paging != NULL && translateAddress( paging,
+                            procID, segment, base, offset, &frame ) == False )
+        {
+            if( frame == NO_FRAME && paging->demand == True )
+            {
+                frame = loadPage( paging, procID, segment, base + offset,
+                                                    &victimPID, &victimVpn );
+                pageFault = True;
+                success = frame != NO_FRAME;
+            }
+
+            if( pageFault == True && success == True )
+            {
+                sprintf( displayString,
+                        "Process: %d, TLB miss, page fault loads frame %d\n",
+                                                            procID, frame );
+                outputEvent( configDataPtr, outputLog,
+                                    accessClock( LAP_TIMER ), displayString );
+
+                if( victimPID != NO_PROCESS )
+                {
+                    sprintf( displayString,
+                        "OS: Page %d of process %d written to swap\n",
+                                                    victimVpn, victimPID );
+                    outputEvent( configDataPtr, outputLog,
+                                    accessClock( LAP_TIMER ), displayString );
+                }
+            }
+            else if( success == True )
+            {
+                sprintf( displayString,
+                        "Process: %d, TLB miss, page walk to frame %d\n",
+                                                            procID, frame );
+                outputEvent( configDataPtr, outputLog,
+                                    accessClock( LAP_TIMER ), displayString );
+            }
+
+            *stallTime = paging->missCost + paging->walkCost;
+
+            if( pageFault == True && success == True )
+            {
+                *faultEnd = scheduleSwap( paging, accessClock( LAP_TIMER )
+                                            + msecToSimTime( *stallTime ),
+                    ( victimPID == NO_PROCESS ? 1 : 2 ) * paging->swapTime );
+            }
+        }
+    }
+
+    if( success == True )
+    {
+        sprintf( displayString, "Process: %d, MMU successful %s\n",
+                                                    procID, opCode->opName );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+    }
+    else
+    {
+        sprintf( displayString, "Process: %d, MMU failed to %s\n\n",
+                                                    procID, opCode->opName );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+
+        sprintf( displayString,
+                        "OS: Process %d experiences segmentation fault\n",
+                                                                    procID );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+    }
+
+    return success;
+}
+
+/*
+Function name: countRunCycles
+Algorithm: Takes the smaller of the cycles left in the quantum and in the
+           run operation, then cuts it to the cycles that pass before the
+           next interrupt is due, either from the interrupt queue or from
+           an I/O request still on a device
+Precondition: Given config, device manager, interrupt queue with or without
+              data or NULL, current time, and a positive quantum and op
+              value
+Postcondition: Returns the number of cycles, at least one, that can run as
+               one step without passing a preemption point
+Exceptions: None
+Note: An interrupt due during a cycle is seen at the end of that cycle,
+      the same point it is seen when the cycles run one at a time
+*/
+int countRunCycles( ConfigDataType *configDataPtr, DeviceManager *devices,
+                    InterruptQueue *interruptQueue, SimTime currentTime,
+                                                    int quantum, int opValue )
+{
+    Interrupt *firstInterrupt = NULL;
+    SimTime deadline, cycleTime;
+    int cycles, dueCycles;
+
+    cycles = quantum < opValue ? quantum : opValue;
+
+    if( interruptQueue != NULL )
+    {
+        firstInterrupt = peekInterrupt( interruptQueue );
+    }
+
+    deadline = nextDeviceDeadline( devices );
+    if( firstInterrupt != NULL
+                && ( deadline < 0 || firstInterrupt->endingTime < deadline ) )
+    {
+        deadline = firstInterrupt->endingTime;
+    }
+
+    if( deadline >= 0 )
+    {
+        cycleTime = msecToSimTime( configDataPtr->procCycleRate );
+        dueCycles = 1;
+
+        if( deadline > currentTime && cycleTime > 0 )
+        {
+            dueCycles = (int)( ( deadline - currentTime + cycleTime - 1 )
+                                                                / cycleTime );
+        }
+
+        if( dueCycles < cycles )
+        {
+            cycles = dueCycles;
+        }
+    }
+
+    return cycles;
+}
+
+/*
+Function name: setPcbReady
+Algorithm: Sets the pcb in READY state and hands it to the scheduler as a
+           process woken from I/O
+Precondition: Given pcb state lists, a pcb leaving BLOCKED state, and the
+              scheduler
+Postcondition: Pcb is READY and can be picked by the scheduler
+Exceptions: None
+Note: None
+*/
+void setPcbReady( PcbStateLists *pcbStates, PcbType *pcb,
+                                                struct Scheduler *scheduler )
+{
+    setPcbState( pcbStates, pcb, READY );
+    scheduler->onWake( scheduler, pcb );
+}
+
+/*
+Function name: takeInterruptBatch
+Algorithm: Drains every interrupt due by the current time from the queue in
+           one pass and charges the interrupt entry cost of each
+Precondition: Given config, interrupt queue, current time, and overhead
+              counts
+Postcondition: Returns number of interrupts in the batch of the queue
+Exceptions: None
+Note: None
+*/
+int takeInterruptBatch( ConfigDataType *configDataPtr,
+                                InterruptQueue *interruptQueue,
+                                SimTime currentTime, OverheadType *overhead )
+{
+    int batchCount = drainInterrupts( interruptQueue, currentTime );
+    int index;
+
+    for( index = 0; index < batchCount; index++ )
+    {
+        chargeOverhead( configDataPtr->interruptCost,
+                                                &overhead->interruptEntries );
+    }
+
+    return batchCount;
+}
+
+/*
+Function name: batchPreempts
+Algorithm: Asks the scheduler, for each process the batch wakes, in order,
+           whether it preempts the running process
+Precondition: Given scheduler, pcb table, interrupt queue holding a drained
+              batch, its size, and the running pcb
+Postcondition: Returns the batch index of the first interrupt whose process
+               preempts the running one, or NO_PREEMPTION
+Exceptions: None
+Note: O(1) per interrupt
+*/
+int batchPreempts( struct Scheduler *scheduler, PcbTable *pcbTable,
+                    InterruptQueue *interruptQueue, int batchCount,
+                                                        PcbType *runningPcb )
+{
+    int index;
+
+    for( index = 0; index < batchCount; index++ )
+    {
+        if( scheduler->preempts( scheduler, runningPcb, lookupPcb( pcbTable,
+                            interruptQueue->batch[ index ].PID ) ) == True )
+        {
+            return index;
+        }
+    }
+
+    return NO_PREEMPTION;
+}
+
+/*
+Function name: wakeInterruptBatch
+Algorithm: Reads the clock once, then for each interrupt of the batch, in
+           order, logs the end of its I/O operation, sets its process
+           READY, and logs the state change, all stamped with that time
+Precondition: Given config, output log, pcb state lists, pcb table,
+              scheduler, interrupt queue holding a drained batch, its size,
+              and whether each interrupt is announced on its own line
+Postcondition: Every process of the batch is READY and its records are in
+               the log as one block
+Exceptions: None
+Note: An interrupt that preempts the running process is announced by the
+      caller instead
+*/
+void wakeInterruptBatch( ConfigDataType *configDataPtr, OutputType *outputLog,
+                    PcbStateLists *pcbStates, PcbTable *pcbTable,
+                    struct Scheduler *scheduler, InterruptQueue *interruptQueue,
+                                            int batchCount, Boolean announce )
+{
+    SimTime currentTime = accessClock( LAP_TIMER );
+    char displayString[ STD_STR_LEN ];
+    Interrupt *interrupt;
+    int index;
+
+    for( index = 0; index < batchCount; index++ )
+    {
+        interrupt = &interruptQueue->batch[ index ];
+
+        if( announce == True )
+        {
+            sprintf( displayString, "OS: Interrupt called by process %d\n\n",
+                                                            interrupt->PID );
+            outputEvent( configDataPtr, outputLog, currentTime,
+                                                                displayString );
+        }
+
+        sprintf( displayString, "Process: %d, %s %s end\n\n",
+            interrupt->PID, getInterruptOpName( interruptQueue, interrupt ),
+                            getInterruptOpType( interruptQueue, interrupt ) );
+        outputEvent( configDataPtr, outputLog, currentTime, displayString );
+
+        setPcbReady( pcbStates, lookupPcb( pcbTable, interrupt->PID ),
+                                                                scheduler );
+
+        sprintf( displayString, "OS: Process %d set in READY state\n",
+                                                            interrupt->PID );
+        outputEvent( configDataPtr, outputLog, currentTime, displayString );
+    }
+}
+
+/*
+Function name: deliverDeviceCompletions
+Algorithm: Takes every I/O completion posted by the device workers and adds
+           it to the interrupt queue at the time it completed
+Precondition: Given device manager and interrupt queue, with or without data
+Postcondition: Returns interrupt queue holding the completed I/O, and the
+               completed requests are returned to OS
+Exceptions: None
+Note: Called at every cycle boundary, so a completion waits at most one
+      cycle before it is seen as an interrupt
+*/
+InterruptQueue *deliverDeviceCompletions( DeviceManager *devices,
+                                            InterruptQueue *interruptQueue )
+{
+    DeviceRequest *request, *nextRequest;
+
+    request = takeDeviceCompletions( devices );
+
+    while( request != NULL )
+    {
+        nextRequest = request->completionNext;
+        interruptQueue = addInterrupt( interruptQueue, request->PID,
+                    request->opType, request->opName, request->endingTime );
+        free( request );
+        request = nextRequest;
+    }
+
+    return interruptQueue;
+}
+
+/*
+Function name: initOverhead
+Algorithm: Zeroes every overhead event count
+Precondition: Given overhead counts
+Postcondition: No overhead has been charged
+Exceptions: None
+Note: None
+*/
+void initOverhead( OverheadType *overhead )
+{
+    overhead->contextSwitches = 0;
+    overhead->decisions = 0;
+    overhead->interruptEntries = 0;
+}
+
+/*
+Function name: chargeOverhead
+Algorithm: Runs the clock for the cost of one overhead event and counts
+           the event
+Precondition: Given cost in milliseconds and the count of its event kind
+Postcondition: Simulated time has advanced by the cost
+Exceptions: None
+Note: A cost of zero leaves the clock untouched
+*/
+void chargeOverhead( int milliSeconds, int *eventCount )
+{
+    if( milliSeconds > 0 )
+    {
+        runClock( milliSeconds );
+    }
+
+    ( *eventCount )++;
+}
+
+/*
+Function name: reportOverhead
+Algorithm: Logs the number of context switches, scheduler decisions, and
+           interrupt entries with the time they cost in total
+Precondition: Given config, output log, and overhead counts
+Postcondition: Overhead summary is displayed and/or stored in the log when
+               any overhead cost is configured
+Exceptions: None
+Note: None
+*/
+void reportOverhead( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                                    OverheadType *overhead )
+{
+    char displayString[ MAX_STR_LEN ];
+
+    if( configDataPtr->switchCost == 0 && configDataPtr->decisionCost == 0
+                                        && configDataPtr->interruptCost == 0 )
+    {
+        return;
+    }
+
+    sprintf( displayString,
+        "OS: Overhead, %d context switches, %d scheduler decisions\n",
+                            overhead->contextSwitches, overhead->decisions );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+
+    sprintf( displayString, "OS: Overhead, %d interrupt entries, %d ms\n",
+        overhead->interruptEntries,
+        overhead->contextSwitches * configDataPtr->switchCost
+            + overhead->decisions * configDataPtr->decisionCost
+            + overhead->interruptEntries * configDataPtr->interruptCost );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+}
+
+/*
+Function name: reportPaging
+Algorithm: Logs the TLB hits, misses, and hit rate of every process that
+           accessed paged memory, then the totals for the whole TLB; under
+           demand paging also logs the page faults of every process and the
+           totals for the swap device
+Precondition: Given config, output log, and paging data or NULL
+Postcondition: Paging summary is displayed and/or stored in the log when
+               paging is on
+Exceptions: None
+Note: None
+*/
+void reportPaging( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                                        PagingType *paging )
+{
+    char displayString[ MAX_STR_LEN ];
+    char policyString[ STD_STR_LEN ];
+    long hits, misses, totalHits = 0, totalMisses = 0, totalFaults = 0;
+    int procID;
+
+    if( paging == NULL )
+    {
+        return;
+    }
+
+    for( procID = 0; procID < paging->tableCount; procID++ )
+    {
+        hits = paging->tlbHits[ procID ];
+        misses = paging->tlbMisses[ procID ];
+
+        if( hits + misses > 0 )
+        {
+            sprintf( displayString,
+                "OS: Process %d, %ld TLB hits, %ld misses, "
+                                                    "%.1f%% hit rate\n",
+                procID, hits, misses, 100.0 * hits / ( hits + misses ) );
+            outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+            totalHits += hits;
+            totalMisses += misses;
+        }
+
+        if( paging->demand == True && paging->pageFaults[ procID ] > 0 )
+        {
+            sprintf( displayString, "OS: Process %d, %ld page faults\n",
+                                        procID, paging->pageFaults[ procID ] );
+            outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+            totalFaults += paging->pageFaults[ procID ];
+        }
+    }
+
+    sprintf( displayString, "OS: TLB of %d entries, %ld hits, %ld misses\n",
+                            paging->tlb.entryCount, totalHits, totalMisses );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+
+    sprintf( displayString, "OS: TLB %.1f%% hit rate, %ld ms translating\n",
+        totalHits + totalMisses > 0
+            ? 100.0 * totalHits / ( totalHits + totalMisses ) : 0.0,
+        totalMisses * ( paging->missCost + paging->walkCost ) );
+    outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+
+    if( paging->demand == True )
+    {
+        configCodeToString( paging->replacementCode, policyString );
+        sprintf( displayString,
+            "OS: %s replacement on %d frames, %ld page faults, "
+                                            "%ld pages written to swap\n",
+            policyString, paging->frameCount, totalFaults, paging->pagesOut );
+        outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+    }
+}
+
 /*
 Function name: initializePbc
 Algorithm: Runs through metadata linked list and at each process start creates
@@ -652,6 +1068,9 @@ int initializePcbs(ConfigDataType *configDataPtr, OpCodeType *mdData,
                 currentPcb->programCounter = currentOpCode->next;
                 currentPcb->state = NEW;
                 currentPcb->PID = processCount;
+                currentPcb->shares = currentOpCode->opValue;
+                currentPcb->deadline =
+                        getProcessDeadline( currentPcb->programCounter );
                 currentPcb->timeRemaining =
                             calculateTimeRemaining( currentPcb->programCounter,
                                                     configDataPtr );;
@@ -699,6 +1118,14 @@ PcbType *addPcb( PcbType *pcbQueue, PcbType *newPcb )
         pcbQueue->PID = newPcb->PID;
         pcbQueue->timeRemaining = newPcb->timeRemaining;
         pcbQueue->state = newPcb->state;
+        pcbQueue->schedLevel = 0;
+        pcbQueue->levelCycles = 0;
+        pcbQueue->levelEpoch = 0;
+        pcbQueue->shares = newPcb->shares;
+        pcbQueue->pass = 0;
+        pcbQueue->deadline = newPcb->deadline;
+        pcbQueue->vruntime = 0;
+        pcbQueue->vruntimeBase = 0;
         pcbQueue->next = NULL;
     }
     else
@@ -708,6 +1135,29 @@ PcbType *addPcb( PcbType *pcbQueue, PcbType *newPcb )
     return pcbQueue;
 }
 
+/*
+Function name: getProcessDeadline
+Algorithm: Runs through metadata linked list from current program counter
+           to the process end and returns the time its value names
+Precondition: Given a pointer to a opcode in a metadata linked list
+Postcondition: Returns deadline as simulated time since the simulator
+               started, or 0 if the process has none
+Exceptions: None
+Note: The value of A(end) is the deadline in milliseconds, e.g.,
+      A(end)250 must finish within 250 ms of the simulator start
+*/
+SimTime getProcessDeadline( OpCodeType *programCounter )
+{
+    OpCodeType *currentOpCode = programCounter;
+
+    while( currentOpCode->opLtr != 'A' )
+    {
+        currentOpCode = currentOpCode->next;
+    }
+
+    return msecToSimTime( currentOpCode->opValue );
+}
+
 /*
 Function name: calculateTimeRemaining
 Algorithm: Runs through metadata linked list from current program counter
@@ -762,20 +1212,6 @@ void setAllPcbStates( PcbType *pcb, int pcbState )
     }
 }
 
-/*
-Function name: simulateOperation
-Algorithm: Simulates a process function by spinning for a set ammount of time
-Precondition: Given a pointer to a integer value
-Postcondition: Set ammount of time has passed
-Exceptions: None
-Note: None
-*/
-void *simulateOperation( void *time )
-{
-    runTimer( *(int *)time );
-    pthread_exit( NULL );
-}
-
 /*
 Function name: displayPcbQueue
 Algorithm: Displays PID, state, and time remaining of all processes
@@ -855,166 +1291,202 @@ void displaySimulatorError( int errCode )
 }
 
 /*
-Function name: sortPCB
-Algorithm: Uses the cpu schedule code within the config file to determine the
-           correct ordering of pcbs for scheduling and sorts the pcb queue
-Precondition: Given pcb queue, with or without data
-Postcondition: Returned sorted pcb queue based on cpu schedule code
+Function name: createPcbTable
+Algorithm: Sizes a table by the highest PID in the pcb queue and stores each
+           pcb at the index of its PID
+Precondition: Given pcb queue, with or without data, whose PIDs were given
+              out in order from zero
+Postcondition: Returns table from which any pcb can be found by PID
 Exceptions: None
-Note:
+Note: The table points at the pcbs of the queue and does not copy them
 */
-PcbType *sortPCB( PcbType *pcbQueue, ConfigDataCodes cpuSchedCode)
+PcbTable *createPcbTable( PcbType *pcbQueue )
 {
-    OpCodeType *tempProgramCounter;
-    int tempState, tempPID, tempTimeRemaining;
-    PcbType *current, *iterator;
-    Boolean swap;
+    PcbTable *pcbTable = (PcbTable *)malloc( sizeof( PcbTable ) );
+    PcbType *pcb;
 
-    if( pcbQueue == NULL || cpuSchedCode == CPU_SCHED_FCFS_N_CODE
-        || cpuSchedCode == CPU_SCHED_FCFS_P_CODE )
-    {
-        return pcbQueue;
-    }
+    pcbTable->size = 0;
 
-    else if( cpuSchedCode == CPU_SCHED_SJF_N_CODE ||
-             cpuSchedCode == CPU_SCHED_SRTF_P_CODE )
+    for( pcb = pcbQueue; pcb != NULL; pcb = pcb->next )
     {
-        swap = True;
-        iterator = NULL;
-
-        while( swap == True )
+        if( pcb->PID >= pcbTable->size )
         {
-            current = pcbQueue;
-            swap = False;
-
-            while( current->next != iterator )
-            {
-                if( current->timeRemaining > current->next->timeRemaining )
-                {
-                    swap = True;
-
-                    tempProgramCounter = current->programCounter;
-                    tempState = current->state;
-                    tempPID = current->PID;
-                    tempTimeRemaining = current->timeRemaining;
-
-                    current->programCounter = current->next->programCounter;
-                    current->state = current->next->state;
-                    current->PID = current->next->PID;
-                    current->timeRemaining = current->next->timeRemaining;
-
-                    current->next->programCounter = tempProgramCounter;
-                    current->next->state = tempState;
-                    current->next->PID = tempPID;
-                    current->next->timeRemaining = tempTimeRemaining;
-                }
-                current = current->next;
-            }
-
-            iterator = current;
+            pcbTable->size = pcb->PID + 1;
         }
     }
 
-    else if( cpuSchedCode == CPU_SCHED_RR_P_CODE )
-    {
-        swap = True;
-        iterator = NULL;
+    pcbTable->byPid = (PcbType **)calloc( pcbTable->size + 1,
+                                                        sizeof( PcbType * ) );
 
-        while( swap == True )
-        {
-            current = pcbQueue;
-            swap = False;
+    for( pcb = pcbQueue; pcb != NULL; pcb = pcb->next )
+    {
+        pcbTable->byPid[ pcb->PID ] = pcb;
+    }
 
-            while( current->next != iterator )
-            {
-                if( current->state == BLOCKED )
-                {
-                    swap = True;
-
-                    tempProgramCounter = current->programCounter;
-                    tempState = current->state;
-                    tempPID = current->PID;
-                    tempTimeRemaining = current->timeRemaining;
-
-                    current->programCounter = current->next->programCounter;
-                    current->state = current->next->state;
-                    current->PID = current->next->PID;
-                    current->timeRemaining = current->next->timeRemaining;
-
-                    current->next->programCounter = tempProgramCounter;
-                    current->next->state = tempState;
-                    current->next->PID = tempPID;
-                    current->next->timeRemaining = tempTimeRemaining;
-                }
-                current = current->next;
-            }
+    return pcbTable;
+}
 
-            iterator = current;
-        }
+/*
+Function name: lookupPcb
+Algorithm: Indexes the table by PID
+Precondition: Given pcb table and a PID
+Postcondition: Returns the pcb with the PID, or NULL if there is none
+Exceptions: None
+Note: O(1)
+*/
+PcbType *lookupPcb( PcbTable *pcbTable, int pid )
+{
+    if( pid < 0 || pid >= pcbTable->size )
+    {
+        return NULL;
     }
 
-    return pcbQueue;
+    return pcbTable->byPid[ pid ];
 }
 
 /*
-Function name: checkIfIdle
-Algorithm: Checks a pcbQueue to see if any pcbs are in a ready state
-Precondition: Given pcbQueue linked list
-Postcondition: Return boolean value of pcbQueue state
+Function name: clearPcbTable
+Algorithm: Returns the table memory to OS
+Precondition: Given pcb table, or NULL
+Postcondition: Table memory is returned to OS, return pointer is set to null
 Exceptions: None
-Note: None
+Note: The pcbs themselves belong to the pcb queue and are not freed
 */
-Boolean checkIfIdle( PcbType *pcbQueue )
+PcbTable *clearPcbTable( PcbTable *pcbTable )
 {
-    while( pcbQueue != NULL)
+    if( pcbTable != NULL )
     {
-        if( pcbQueue->state == READY )
-        {
-            return False;
-        }
-        pcbQueue = pcbQueue->next;
+        free( pcbTable->byPid );
+        free( pcbTable );
     }
-    return True;
+
+    return NULL;
 }
 
 /*
-Function name: checkIfEnded
-Algorithm: Checks a pcbQueue to see if all pcbs are in an exit state
-Precondition: Given pcbQueue linked list
-Postcondition: Return boolean value of pcbQueue state
+Function name: initPcbStates
+Algorithm: Empties the state lists, then appends every pcb of the pcb queue
+           to the list of its state in queue order
+Precondition: Given state lists and pcb queue, with or without data
+Postcondition: Every pcb is in the list of its state and every state count
+               is set
 Exceptions: None
 Note: None
 */
-Boolean checkIfEnded( PcbType *pcbQueue )
+void initPcbStates( PcbStateLists *pcbStates, PcbType *pcbQueue )
 {
-    while( pcbQueue != NULL)
+    PcbState state;
+    PcbType *pcb;
+
+    for( state = NEW; state < PCB_STATE_COUNT; state++ )
     {
-        if( pcbQueue->state != EXIT )
-        {
-            return False;
-        }
-        pcbQueue = pcbQueue->next;
+        pcbStates->head[ state ] = NULL;
+        pcbStates->tail[ state ] = NULL;
+        pcbStates->count[ state ] = 0;
+    }
+
+    for( pcb = pcbQueue; pcb != NULL; pcb = pcb->next )
+    {
+        state = pcb->state;
+        pcb->state = PCB_STATE_COUNT;
+        setPcbState( pcbStates, pcb, state );
     }
-    return True;
 }
 
 /*
-Function name: getNextPcb
-Algorithm: Search pcbQueue list to find the next node with given state
-Precondition: Given pcbQueue linked list
-Postcondition: Returned pcb with given state
+Function name: setPcbState
+Algorithm: Unlinks the pcb from the list of its current state and appends
+           it to the list of the new state, moving one from the old count to
+           the new count
+Precondition: Given state lists, a pcb in the lists, and its new state
+Postcondition: Pcb is in the given state and at the tail of its list
 Exceptions: None
-Note: None
+Note: O(1); a pcb already in the given state is left where it is
 */
-PcbType *getNextPcb( PcbType *pcbQueue, PcbState pcbState )
+void setPcbState( PcbStateLists *pcbStates, PcbType *pcb, PcbState state )
 {
-    while( pcbQueue != NULL)
+    if( pcb->state == state )
+    {
+        return;
+    }
+
+    if( pcb->state < PCB_STATE_COUNT )
     {
-        if( pcbQueue->state == pcbState )
+        if( pcb->statePrev == NULL )
+        {
+            pcbStates->head[ pcb->state ] = pcb->stateNext;
+        }
+        else
+        {
+            pcb->statePrev->stateNext = pcb->stateNext;
+        }
+
+        if( pcb->stateNext == NULL )
+        {
+            pcbStates->tail[ pcb->state ] = pcb->statePrev;
+        }
+        else
         {
-            return pcbQueue;
+            pcb->stateNext->statePrev = pcb->statePrev;
         }
-        pcbQueue = pcbQueue->next;
+
+        pcbStates->count[ pcb->state ]--;
     }
-    return NULL;
+
+    pcb->state = state;
+    pcb->stateNext = NULL;
+    pcb->statePrev = pcbStates->tail[ state ];
+
+    if( pcbStates->tail[ state ] == NULL )
+    {
+        pcbStates->head[ state ] = pcb;
+    }
+    else
+    {
+        pcbStates->tail[ state ]->stateNext = pcb;
+    }
+
+    pcbStates->tail[ state ] = pcb;
+    pcbStates->count[ state ]++;
+}
+
+/*
+Function name: checkIfIdle
+Algorithm: Checks the count of pcbs in ready state
+Precondition: Given pcb state lists
+Postcondition: Returns True if no pcb is ready
+Exceptions: None
+Note: O(1)
+*/
+Boolean checkIfIdle( PcbStateLists *pcbStates )
+{
+    return pcbStates->count[ READY ] == 0;
+}
+
+/*
+Function name: checkIfEnded
+Algorithm: Checks the counts of pcbs in every state but exit
+Precondition: Given pcb state lists
+Postcondition: Returns True if every pcb is in exit state
+Exceptions: None
+Note: O(1)
+*/
+Boolean checkIfEnded( PcbStateLists *pcbStates )
+{
+    return pcbStates->count[ NEW ] == 0 && pcbStates->count[ READY ] == 0
+                                    && pcbStates->count[ RUNNING ] == 0
+                                    && pcbStates->count[ BLOCKED ] == 0;
+}
+
+/*
+Function name: getNextPcb
+Algorithm: Returns the head of the list of the given state
+Precondition: Given pcb state lists and a pcb state
+Postcondition: Returns the pcb longest in the given state, or NULL if none
+Exceptions: None
+Note: O(1)
+*/
+PcbType *getNextPcb( PcbStateLists *pcbStates, PcbState pcbState )
+{
+    return pcbStates->head[ pcbState ];
 }
@@ -16,14 +16,18 @@ Note: None
 
 // Header files ///////////////////////////////////////////////////////////////
 
-#include "simtimer.h"
+#include "SimClock.h"
 #include "ConfigAccess.h"
 #include "MetaDataAccess.h"
 #include "OutputHandling.h"
 #include "MMU.h"
+#include "Paging.h"
 #include "InterruptHandling.h"
-#include <pthread.h>
+#include "DeviceManager.h"
 
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define NO_PREEMPTION -1
 
 // Data Structure Definitions (structs, enums, etc.)//////////////////////////
 
@@ -38,7 +42,8 @@ typedef enum PcbState
     READY,
     RUNNING,
     BLOCKED,
-    EXIT
+    EXIT,
+    PCB_STATE_COUNT
 } PcbState;
 
 typedef struct PcbType
@@ -47,27 +52,95 @@ typedef struct PcbType
     PcbState state;
     int PID;
     int timeRemaining;
+    int heapIndex;
+    int homeCore;
+    int schedLevel;
+    int levelCycles;
+    int levelEpoch;
+    int shares;
+    long pass;
+    SimTime deadline;
+    long vruntime;
+    long vruntimeBase;
+    struct PcbType *treeParent;
+    struct PcbType *treeLeft;
+    struct PcbType *treeRight;
+    Boolean treeRed;
+    struct PcbType *stateNext;
+    struct PcbType *statePrev;
     struct PcbType *next;
 } PcbType;
 
+typedef struct PcbStateLists
+{
+    PcbType *head[ PCB_STATE_COUNT ];
+    PcbType *tail[ PCB_STATE_COUNT ];
+    int count[ PCB_STATE_COUNT ];
+} PcbStateLists;
+
+struct Scheduler;
+
+typedef struct PcbTable
+{
+    PcbType **byPid;
+    int size;
+} PcbTable;
+
+typedef struct OverheadType
+{
+    int contextSwitches;
+    int decisions;
+    int interruptEntries;
+} OverheadType;
+
 // Function Prototypes  ///////////////////////////////////////////////////////
 
 int runSimulator( ConfigDataType *configDataPtr, OpCodeType *mdData);
 int initializePcbs(ConfigDataType *configDataPtr, OpCodeType *mdData,
                                                     PcbType **pcbQueue);
 PcbType *addPcb( PcbType *pcbQueue, PcbType *newPcb );
+SimTime getProcessDeadline( OpCodeType *programCounter );
 int calculateTimeRemaining( OpCodeType *programCounter,
                                             ConfigDataType *configDataPtr );
 void setAllPcbStates( PcbType *pcb, int pcbState );
-void *simulateOperation( void *time );
 void displayPcbQueue( PcbType *pcb );
 void pcbStateToString( int code, char *outString );
 PcbType *clearPcbQueue( PcbType *localPtr );
 void displaySimulatorError( int errCode );
-PcbType *sortPCB( PcbType *pcbQueue, ConfigDataCodes cpuSchedCode);
-Boolean checkIfIdle( PcbType *pcbQueue );
-Boolean checkIfEnded( PcbType *pcbQueue );
-PcbType *getNextPcb( PcbType *pcbQueue, PcbState state );
+PcbTable *createPcbTable( PcbType *pcbQueue );
+PcbType *lookupPcb( PcbTable *pcbTable, int pid );
+PcbTable *clearPcbTable( PcbTable *pcbTable );
+void initPcbStates( PcbStateLists *pcbStates, PcbType *pcbQueue );
+void setPcbState( PcbStateLists *pcbStates, PcbType *pcb, PcbState state );
+Boolean checkIfIdle( PcbStateLists *pcbStates );
+Boolean checkIfEnded( PcbStateLists *pcbStates );
+PcbType *getNextPcb( PcbStateLists *pcbStates, PcbState state );
+Boolean simulateMemoryOp( ConfigDataType *configDataPtr, OutputType *outputLog,
+    MMU **memory, int *memRemaining, PagingType *paging, int procID,
+                OpCodeType *opCode, int *stallTime, SimTime *faultEnd );
+int countRunCycles( ConfigDataType *configDataPtr, DeviceManager *devices,
+    InterruptQueue *interruptQueue, SimTime currentTime, int quantum,
+                                                                int opValue );
+void setPcbReady( PcbStateLists *pcbStates, PcbType *pcb,
+                                                struct Scheduler *scheduler );
+int takeInterruptBatch( ConfigDataType *configDataPtr,
+                                InterruptQueue *interruptQueue,
+                                SimTime currentTime, OverheadType *overhead );
+int batchPreempts( struct Scheduler *scheduler, PcbTable *pcbTable,
+                    InterruptQueue *interruptQueue, int batchCount,
+                                                        PcbType *runningPcb );
+void wakeInterruptBatch( ConfigDataType *configDataPtr, OutputType *outputLog,
+                    PcbStateLists *pcbStates, PcbTable *pcbTable,
+                    struct Scheduler *scheduler, InterruptQueue *interruptQueue,
+                                            int batchCount, Boolean announce );
+InterruptQueue *deliverDeviceCompletions( DeviceManager *devices,
+                                            InterruptQueue *interruptQueue );
+void initOverhead( OverheadType *overhead );
+void chargeOverhead( int milliSeconds, int *eventCount );
+void reportOverhead( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                                    OverheadType *overhead );
+void reportPaging( ConfigDataType *configDataPtr, OutputType *outputLog,
+                                                        PagingType *paging );
 
 // Terminating Precompiler Directives ////////////////////////////////////////
 #endif // SIMULATOR_H
@@ -0,0 +1,352 @@
+// Code Implementation File Information ///////////////////////////////
+/*
+File: StrideScheduler.c
+Brief: Implementation file for proportional-share scheduling code
+Details: Implements the STRIDE-P and LOTTERY-P policies; every process
+         holds a number of shares from the value of its A(start) line, the
+         stride policy runs the READY process with the least pass and
+         advances its pass by its stride for every cycle run, and the
+         lottery policy draws a winner weighted by shares; the share
+         accounting is kept once for the schedulers of every core
+Version: 1.0
+         17 October 2026
+         Initial development of StrideScheduler code
+Note: None
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include "StrideScheduler.h"
+
+/*
+Function name: createStridePolicy
+Algorithm: Builds a heap keyed on pass, takes the per-PID share accounting
+           from shareWith or builds it here, and sets the stride or lottery
+           hooks of the scheduler
+Precondition: Given scheduler, simulator config, number of processes, and
+              stride scheduler of another core, or NULL
+Postcondition: Scheduler runs STRIDE-P or LOTTERY-P with no READY process
+Exceptions: None
+Note: The lottery draws from its own generator seeded by the config, so
+      a run can be repeated exactly
+*/
+void createStridePolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith )
+{
+    StridePolicy *policy = (StridePolicy *)malloc( sizeof( StridePolicy ) );
+    StrideShare *share;
+    int pid;
+
+    policy->ready = createPcbHeap( pcbCount, HEAP_KEY_PASS );
+    policy->lottery = configDataPtr->cpuSchedCode == CPU_SCHED_LOTTERY_P_CODE;
+    policy->seed = (unsigned int)configDataPtr->lotterySeed;
+    policy->readyTickets = 0;
+
+    if( shareWith != NULL )
+    {
+        share = (StrideShare *)shareWith->sharedData;
+    }
+    else
+    {
+        share = (StrideShare *)malloc( sizeof( StrideShare ) );
+        pthread_mutex_init( &share->shareLock, NULL );
+        share->pcbCount = pcbCount;
+        share->shares = (int *)malloc( pcbCount * sizeof( int ) );
+        share->cyclesRun = (long *)malloc( pcbCount * sizeof( long ) );
+        share->joinCycle = (long *)malloc( pcbCount * sizeof( long ) );
+        share->exitCycle = (long *)malloc( pcbCount * sizeof( long ) );
+        share->joinFair = (double *)malloc( pcbCount * sizeof( double ) );
+        share->exitFair = (double *)malloc( pcbCount * sizeof( double ) );
+        share->totalCycles = 0;
+        share->activeShares = 0;
+        share->fairPerShare = 0.0;
+
+        for( pid = 0; pid < pcbCount; pid++ )
+        {
+            share->shares[ pid ] = 0;
+            share->cyclesRun[ pid ] = 0;
+            share->joinCycle[ pid ] = 0;
+            share->exitCycle[ pid ] = 0;
+            share->joinFair[ pid ] = 0.0;
+            share->exitFair[ pid ] = 0.0;
+        }
+
+        scheduler->ownsShared = True;
+    }
+
+    policy->share = share;
+
+    scheduler->policyData = policy;
+    scheduler->sharedData = share;
+    scheduler->preemptive = True;
+    scheduler->enqueue = strideEnqueue;
+    scheduler->onWake = strideWake;
+    scheduler->onTick = strideTick;
+    scheduler->onExit = strideExit;
+    scheduler->report = strideReport;
+    scheduler->clearPolicy = clearStridePolicy;
+
+    if( policy->lottery == True )
+    {
+        scheduler->pickNext = lotteryPickNext;
+    }
+    else
+    {
+        scheduler->pickNext = stridePickNext;
+    }
+}
+
+/*
+Function name: strideEnqueue
+Algorithm: When the pcb first arrives, records its shares, the cycle count
+           it joined at, and the fair cycles per share owed so far, and
+           adds its shares to those competing; then pushes it onto the pass
+           heap
+Precondition: Given stride scheduler and a READY pcb not in the heap
+Postcondition: Pcb is in the heap at its place by pass
+Exceptions: None
+Note: O(log n)
+*/
+void strideEnqueue( Scheduler *scheduler, PcbType *pcb )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    StrideShare *share = policy->share;
+
+    pthread_mutex_lock( &share->shareLock );
+
+    if( share->shares[ pcb->PID ] == 0 )
+    {
+        share->shares[ pcb->PID ] = getPcbShares( pcb );
+        share->joinCycle[ pcb->PID ] = share->totalCycles;
+        share->joinFair[ pcb->PID ] = share->fairPerShare;
+        share->activeShares += getPcbShares( pcb );
+    }
+
+    pthread_mutex_unlock( &share->shareLock );
+
+    policy->readyTickets += getPcbShares( pcb );
+    pushPcbHeap( policy->ready, pcb );
+}
+
+/*
+Function name: strideWake
+Algorithm: Moves the pass of a pcb returning from I/O up to the least pass
+           of the READY pcbs, then enqueues it
+Precondition: Given stride scheduler and a pcb leaving BLOCKED state
+Postcondition: Pcb is in the heap at its place by pass
+Exceptions: None
+Note: Keeps a process from banking CPU time while it is blocked and
+      then holding the CPU until the others catch up
+*/
+void strideWake( Scheduler *scheduler, PcbType *pcb )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    PcbType *leader = peekPcbHeap( policy->ready );
+
+    if( leader != NULL && pcb->pass < leader->pass )
+    {
+        pcb->pass = leader->pass;
+    }
+
+    strideEnqueue( scheduler, pcb );
+}
+
+/*
+Function name: stridePickNext
+Algorithm: Pops the pcb with the least pass
+Precondition: Given stride scheduler
+Postcondition: Returns pcb to run, or NULL if none is READY
+Exceptions: None
+Note: O(log n)
+*/
+PcbType *stridePickNext( Scheduler *scheduler )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    PcbType *pcb = popPcbHeap( policy->ready );
+
+    if( pcb != NULL )
+    {
+        policy->readyTickets -= getPcbShares( pcb );
+    }
+
+    return pcb;
+}
+
+/*
+Function name: lotteryPickNext
+Algorithm: Draws a ticket among the shares of all READY pcbs and removes
+           the pcb holding it from the heap
+Precondition: Given lottery scheduler
+Postcondition: Returns pcb to run, or NULL if none is READY
+Exceptions: None
+Note: O(n) to find the winner; the heap is only used as the set of READY
+      pcbs here
+*/
+PcbType *lotteryPickNext( Scheduler *scheduler )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    PcbType *winner;
+    long ticket;
+    int index = 0;
+
+    if( policy->ready->size == 0 )
+    {
+        return NULL;
+    }
+
+    ticket = drawLotteryTicket( policy ) % policy->readyTickets;
+    winner = policy->ready->nodes[ index ];
+
+    while( ticket >= getPcbShares( winner ) )
+    {
+        ticket -= getPcbShares( winner );
+        index++;
+        winner = policy->ready->nodes[ index ];
+    }
+
+    removePcbHeap( policy->ready, winner );
+    policy->readyTickets -= getPcbShares( winner );
+
+    return winner;
+}
+
+/*
+Function name: strideTick
+Algorithm: Advances the pass of the pcb by its stride for each cycle run,
+           charges the cycles to its PID, and owes each competing share
+           its part of the cycles
+Precondition: Given stride scheduler, running pcb, and cycles it just ran
+Postcondition: Pass and share accounting are brought up to date
+Exceptions: None
+Note: The stride is STRIDE_ONE divided by the pcb's shares; a process
+      that is BLOCKED still competes, so the cycles it gives up count
+      against it
+*/
+void strideTick( Scheduler *scheduler, PcbType *pcb, int cycles )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    StrideShare *share = policy->share;
+
+    pcb->pass += ( STRIDE_ONE / getPcbShares( pcb ) ) * cycles;
+
+    pthread_mutex_lock( &share->shareLock );
+    share->cyclesRun[ pcb->PID ] += cycles;
+    share->totalCycles += cycles;
+    share->fairPerShare += (double)cycles / share->activeShares;
+    pthread_mutex_unlock( &share->shareLock );
+}
+
+/*
+Function name: strideExit
+Algorithm: Records the cycle count and the fair cycles per share owed
+           when the pcb left the system, and drops its shares from those
+           competing
+Precondition: Given stride scheduler and a pcb set in EXIT state
+Postcondition: Window the pcb competed in is closed
+Exceptions: None
+Note: None
+*/
+void strideExit( Scheduler *scheduler, PcbType *pcb )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    StrideShare *share = policy->share;
+
+    pthread_mutex_lock( &share->shareLock );
+    share->exitCycle[ pcb->PID ] = share->totalCycles;
+    share->exitFair[ pcb->PID ] = share->fairPerShare;
+    share->activeShares -= share->shares[ pcb->PID ];
+    pthread_mutex_unlock( &share->shareLock );
+}
+
+/*
+Function name: strideReport
+Algorithm: Logs, for every process scheduled, its shares, the part of the
+           cycles run between its arrival and its exit that its shares
+           entitled it to, and the part it received
+Precondition: Given stride scheduler, config, and output log
+Postcondition: Expected and achieved CPU shares are displayed and/or stored
+               in the log
+Exceptions: None
+Note: Every cycle run is owed to the processes competing at the time, in
+      proportion to their shares, so both figures are parts of the same
+      cycles and can be compared; cycles run on every core count
+*/
+void strideReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog )
+{
+    StrideShare *share = ( (StridePolicy *)scheduler->policyData )->share;
+    char displayString[ MAX_STR_LEN ];
+    double expected;
+    long window;
+    int pid;
+
+    for( pid = 0; pid < share->pcbCount; pid++ )
+    {
+        if( share->shares[ pid ] > 0 )
+        {
+            window = share->exitCycle[ pid ] - share->joinCycle[ pid ];
+            expected = share->shares[ pid ]
+                        * ( share->exitFair[ pid ] - share->joinFair[ pid ] );
+
+            sprintf( displayString,
+                "OS: Process %d, %d shares, %.1f%% expected, "
+                                                    "%.1f%% achieved\n",
+                pid, share->shares[ pid ],
+                window <= 0 ? 0.0 : 100.0 * expected / window,
+                window <= 0 ? 0.0 :
+                            100.0 * share->cyclesRun[ pid ] / window );
+            outputEvent( configDataPtr, outputLog, accessClock( LAP_TIMER ),
+                                                                displayString );
+        }
+    }
+}
+
+/*
+Function name: clearStridePolicy
+Algorithm: Frees the heap, the share accounting if this scheduler built
+           it, and the policy
+Precondition: Given stride scheduler
+Postcondition: Policy memory is returned to OS
+Exceptions: None
+Note: None
+*/
+void clearStridePolicy( Scheduler *scheduler )
+{
+    StridePolicy *policy = (StridePolicy *)scheduler->policyData;
+    StrideShare *share = policy->share;
+
+    policy->ready = clearPcbHeap( policy->ready );
+
+    if( scheduler->ownsShared == True )
+    {
+        pthread_mutex_destroy( &share->shareLock );
+        free( share->shares );
+        free( share->cyclesRun );
+        free( share->joinCycle );
+        free( share->exitCycle );
+        free( share->joinFair );
+        free( share->exitFair );
+        free( share );
+    }
+
+    free( policy );
+    scheduler->policyData = NULL;
+    scheduler->sharedData = NULL;
+}
+
+/*
+Function name: drawLotteryTicket
+Algorithm: Advances the xorshift generator of the policy and returns its
+           next value
+Precondition: Given lottery policy with a nonzero seed
+Postcondition: Returns next pseudo-random value
+Exceptions: None
+Note: Same seed gives the same draws on every platform
+*/
+unsigned int drawLotteryTicket( StridePolicy *policy )
+{
+    policy->seed ^= policy->seed << 13;
+    policy->seed ^= policy->seed >> 17;
+    policy->seed ^= policy->seed << 5;
+
+    return policy->seed;
+}
@@ -0,0 +1,67 @@
+// Header File Information ////////////////////////////////////////////
+/*
+File: StrideScheduler.h
+Brief: Header file for proportional-share scheduling code
+Details: Specifies functions, constants, and other information
+         related to stride and lottery scheduling code
+Version: 1.0
+         17 October 2026
+         Initial development of StrideScheduler code
+Note: None
+*/
+
+// Precompiler directives /////////////////////////////////////////////////////
+#ifndef STRIDE_SCHEDULER_H
+#define STRIDE_SCHEDULER_H
+
+// Header files ///////////////////////////////////////////////////////////////
+
+#include "Scheduler.h"
+
+// Global Constant Definitions ////////////////////////////////////////////////
+
+#define STRIDE_ONE ( 1L << 20 )
+
+// Data Structure Definitions (structs, enums, etc.)//////////////////////////
+
+typedef struct StrideShare
+{
+    pthread_mutex_t shareLock;
+    int pcbCount;
+    int *shares;
+    long *cyclesRun;
+    long *joinCycle;
+    long *exitCycle;
+    double *joinFair;
+    double *exitFair;
+    long totalCycles;
+    long activeShares;
+    double fairPerShare;
+} StrideShare;
+
+typedef struct StridePolicy
+{
+    PcbHeap *ready;
+    Boolean lottery;
+    unsigned int seed;
+    long readyTickets;
+    StrideShare *share;
+} StridePolicy;
+
+// Function Prototypes  ///////////////////////////////////////////////////////
+
+void createStridePolicy( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                        int pcbCount, Scheduler *shareWith );
+void strideEnqueue( Scheduler *scheduler, PcbType *pcb );
+void strideWake( Scheduler *scheduler, PcbType *pcb );
+PcbType *stridePickNext( Scheduler *scheduler );
+PcbType *lotteryPickNext( Scheduler *scheduler );
+void strideTick( Scheduler *scheduler, PcbType *pcb, int cycles );
+void strideExit( Scheduler *scheduler, PcbType *pcb );
+void strideReport( Scheduler *scheduler, ConfigDataType *configDataPtr,
+                                                        OutputType *outputLog );
+void clearStridePolicy( Scheduler *scheduler );
+unsigned int drawLotteryTicket( StridePolicy *policy );
+
+// Terminating Precompiler Directives ////////////////////////////////////////
+#endif // STRIDE_SCHEDULER_H
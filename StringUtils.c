@@ -359,7 +359,7 @@ Note: None
 float stringToFloat( char *str )
 {
     int digit;
-    Boolean decimal;
+    Boolean decimal = False;
     float result = 0, factor = 1;
 
     for( ; *str; str++ )
@@ -0,0 +1,255 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: InterruptQueueBenchmark.c
+Brief: Driver program to compare the timing wheel with the binary heap
+Details: Feeds the same mix of near, far, and overflow completions to a
+         heap queue and a wheel queue and checks they hand interrupts back
+         in the same order, through removeInterupt and drainInterrupts;
+         then times each queue holding 100k outstanding completions, each
+         one taken replaced by a new one, as the simulator does
+Version: 1.0
+         17 October 2026
+         Initial development of interrupt queue benchmark driver program
+Note: Build and run from the repository root with
+          gcc -O2 -I. -o interruptQueueBenchmark
+                tests/InterruptQueueBenchmark.c InterruptHandling.c
+                StringUtils.c ConfigAccess.c SimClock.c simtimer.c
+          ./interruptQueueBenchmark [outstanding count]
+      Returns zero (0) when both queues agree
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include <time.h>
+#include "InterruptHandling.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define BENCH_OUTSTANDING 100000
+#define BENCH_ROUNDS 4
+#define BENCH_MAX_DELAY_MSEC 200000
+#define BENCH_CHECK_DELAY_MSEC 50
+#define BENCH_OVERFLOW_STEP_MSEC 30000000
+
+// Function Prototypes  ///////////////////////////////////////////
+unsigned int nextBenchRandom( unsigned int *state );
+SimTime drawCompletionDelay( unsigned int *state, int maxDelay );
+long compareQueues( int operations );
+double timeQueue( Boolean useWheel, int outstanding );
+
+/*
+Function name: main
+Algorithm: Checks the two queues agree, then times each of them
+Precondition: Optional outstanding completion count as command line
+              argument
+Postcondition: Returns zero (0) when both queues agree, one (1) otherwise
+Exceptions: None
+Note: None
+*/
+int main( int argc, char **argv )
+{
+    int outstanding = BENCH_OUTSTANDING;
+    long mismatches;
+    double heapSeconds, wheelSeconds;
+
+    if( argc > 1 )
+    {
+        outstanding = atoi( argv[ 1 ] );
+    }
+
+    mismatches = compareQueues( outstanding );
+    printf( "%d operations, %ld order mismatches\n", outstanding,
+                                                                mismatches );
+
+    heapSeconds = timeQueue( False, outstanding );
+    wheelSeconds = timeQueue( True, outstanding );
+
+    printf( "%d outstanding, %d replaced: heap %.3f s, wheel %.3f s\n",
+                    outstanding, BENCH_ROUNDS * outstanding, heapSeconds,
+                                                                wheelSeconds );
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+Function name: nextBenchRandom
+Algorithm: Advances a xorshift generator
+Precondition: Given generator state
+Postcondition: Returns the next pseudo-random value
+Exceptions: None
+Note: Fixed seeds keep runs repeatable
+*/
+unsigned int nextBenchRandom( unsigned int *state )
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/*
+Function name: drawCompletionDelay
+Algorithm: Draws how far ahead a completion is due; most fall within the
+           given number of milliseconds with sub-millisecond parts, one in
+           ten falls within the current tick, and one in a hundred falls
+           far past the top wheel level
+Precondition: Given generator state and maximum delay in milliseconds
+Postcondition: Returns the delay
+Exceptions: None
+Note: None
+*/
+SimTime drawCompletionDelay( unsigned int *state, int maxDelay )
+{
+    int choice = nextBenchRandom( state ) % 100;
+
+    if( choice == 0 )
+    {
+        return (SimTime)( nextBenchRandom( state ) % 1000 )
+                                * BENCH_OVERFLOW_STEP_MSEC * NSEC_PER_MSEC;
+    }
+
+    if( choice < 10 )
+    {
+        return nextBenchRandom( state ) % NSEC_PER_MSEC;
+    }
+
+    return (SimTime)( nextBenchRandom( state ) % maxDelay ) * NSEC_PER_MSEC
+                                + nextBenchRandom( state ) % NSEC_PER_MSEC;
+}
+
+/*
+Function name: compareQueues
+Algorithm: Applies the same random adds, removes, and drains to a heap
+           queue and a wheel queue, moving the current time to each
+           interrupt taken, and compares every interrupt they hand back;
+           then empties both
+Precondition: Given number of operations
+Postcondition: Returns the number of interrupts that differ, are out of
+               ending time order, or are left in only one queue
+Exceptions: None
+Note: Both queues number their interrupts the same way, so the sequence
+      names the interrupt; delays are kept short so many interrupts share
+      a tick
+*/
+long compareQueues( int operations )
+{
+    InterruptQueue *heapQueue = createInterruptQueue( 0, False );
+    InterruptQueue *wheelQueue = createInterruptQueue( 0, True );
+    Interrupt *heapFirst, *wheelFirst;
+    SimTime currentTime = 0, dueTime, lastTime = 0;
+    unsigned int randomState = 7;
+    long mismatches = 0;
+    int index, choice, heapCount, wheelCount, batchIndex;
+
+    for( index = 0; index < operations; index++ )
+    {
+        choice = nextBenchRandom( &randomState ) % 8;
+
+        if( choice < 5 )
+        {
+            dueTime = currentTime + drawCompletionDelay( &randomState,
+                                                    BENCH_CHECK_DELAY_MSEC );
+            heapQueue = addInterrupt( heapQueue, index, "input", "keyboard",
+                                                                    dueTime );
+            wheelQueue = addInterrupt( wheelQueue, index, "input",
+                                                        "keyboard", dueTime );
+        }
+        else if( choice < 7 )
+        {
+            heapFirst = peekInterrupt( heapQueue );
+            wheelFirst = peekInterrupt( wheelQueue );
+
+            if( heapFirst == NULL || wheelFirst == NULL )
+            {
+                mismatches += heapFirst != wheelFirst;
+                continue;
+            }
+
+            mismatches += heapFirst->sequence != wheelFirst->sequence
+                                    || heapFirst->endingTime < lastTime;
+            lastTime = currentTime = heapFirst->endingTime;
+            heapQueue = removeInterupt( heapQueue );
+            wheelQueue = removeInterupt( wheelQueue );
+        }
+        else
+        {
+            currentTime += (SimTime)( nextBenchRandom( &randomState )
+                                    % BENCH_CHECK_DELAY_MSEC ) * NSEC_PER_MSEC;
+            heapCount = drainInterrupts( heapQueue, currentTime );
+            wheelCount = drainInterrupts( wheelQueue, currentTime );
+            mismatches += heapCount != wheelCount;
+
+            for( batchIndex = 0; batchIndex < heapCount
+                                && batchIndex < wheelCount; batchIndex++ )
+            {
+                mismatches += heapQueue->batch[ batchIndex ].sequence
+                            != wheelQueue->batch[ batchIndex ].sequence
+                        || heapQueue->batch[ batchIndex ].endingTime
+                                                                < lastTime;
+                lastTime = heapQueue->batch[ batchIndex ].endingTime;
+            }
+        }
+    }
+
+    while( ( heapFirst = peekInterrupt( heapQueue ) ) != NULL )
+    {
+        wheelFirst = peekInterrupt( wheelQueue );
+        mismatches += wheelFirst == NULL
+                            || heapFirst->sequence != wheelFirst->sequence;
+        heapQueue = removeInterupt( heapQueue );
+
+        if( wheelFirst != NULL )
+        {
+            wheelQueue = removeInterupt( wheelQueue );
+        }
+    }
+
+    mismatches += peekInterrupt( wheelQueue ) != NULL;
+
+    heapQueue = clearInterruptQueue( heapQueue );
+    wheelQueue = clearInterruptQueue( wheelQueue );
+
+    return mismatches;
+}
+
+/*
+Function name: timeQueue
+Algorithm: Fills a queue with the given number of completions, then
+           BENCH_ROUNDS times that many times takes the earliest one,
+           moves the current time to it, and adds a new completion
+Precondition: Given whether to use the timing wheel and the number of
+              outstanding completions
+Postcondition: Returns the processor time spent, in seconds
+Exceptions: None
+Note: Both queues see the same completions
+*/
+double timeQueue( Boolean useWheel, int outstanding )
+{
+    InterruptQueue *interruptQueue = createInterruptQueue( 0, useWheel );
+    Interrupt *first;
+    SimTime currentTime = 0;
+    unsigned int randomState = 11;
+    clock_t start = clock();
+    int index;
+
+    for( index = 0; index < outstanding; index++ )
+    {
+        interruptQueue = addInterrupt( interruptQueue, index, "input",
+                        "keyboard", currentTime + drawCompletionDelay(
+                                    &randomState, BENCH_MAX_DELAY_MSEC ) );
+    }
+
+    for( index = 0; index < BENCH_ROUNDS * outstanding; index++ )
+    {
+        first = peekInterrupt( interruptQueue );
+        currentTime = first->endingTime;
+        interruptQueue = removeInterupt( interruptQueue );
+        interruptQueue = addInterrupt( interruptQueue, index, "output",
+                        "monitor", currentTime + drawCompletionDelay(
+                                    &randomState, BENCH_MAX_DELAY_MSEC ) );
+    }
+
+    interruptQueue = clearInterruptQueue( interruptQueue );
+
+    return (double)( clock() - start ) / CLOCKS_PER_SEC;
+}
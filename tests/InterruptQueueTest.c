@@ -0,0 +1,223 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: InterruptQueueTest.c
+Brief: Driver program to check the order interrupts leave the queue in
+Details: Makes thousands of addInterrupt calls with ending times out of
+         order and often equal, mixed with removeInterupt calls, then
+         empties the queue with drainInterrupts; every interrupt taken is
+         checked against a brute force search of the ones still pending,
+         so they must leave in ending time order, ties in the order they
+         were added
+Version: 1.0
+         17 October 2026
+         Initial development of interrupt queue test driver program
+Note: Build and run from the repository root with
+          gcc -I. -o interruptQueueTest tests/InterruptQueueTest.c
+                InterruptHandling.c StringUtils.c ConfigAccess.c
+                                                SimClock.c simtimer.c
+          ./interruptQueueTest [interrupt count]
+      Returns zero (0) when every check passes
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include "InterruptHandling.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define TEST_INTERRUPTS 5000
+#define TEST_TIME_SPREAD 500
+#define TEST_DRAIN_STEP 37
+
+// Data Structure Definitions (structs, enums, etc.)////////////////
+typedef struct PendingRecord
+{
+    SimTime endingTime;
+    int PID;
+    Boolean pending;
+} PendingRecord;
+
+// Function Prototypes  ///////////////////////////////////////////
+unsigned int nextTestRandom( unsigned int *state );
+int findEarliestPending( PendingRecord *records, int recordCount );
+int checkTaken( InterruptQueue *interruptQueue, Interrupt *interrupt,
+                                PendingRecord *records, int recordCount );
+
+/*
+Function name: main
+Algorithm: Adds interrupts with ending times drawn from a window that
+           creeps forward, so new ones often land before pending ones,
+           removing the earliest one about every third step; then drains
+           the rest in steps of TEST_DRAIN_STEP time units
+Precondition: Optional interrupt count as command line argument
+Postcondition: Returns zero (0) when every check passes, one (1) otherwise
+Exceptions: None
+Note: The PID of each interrupt is the order it was added in, so the
+      brute force search breaks ties by the lower PID
+*/
+int main( int argc, char **argv )
+{
+    int interruptCount = TEST_INTERRUPTS, added = 0, taken = 0;
+    int failures = 0, batchCount, index;
+    unsigned int randomState = 2026;
+    SimTime windowStart = 0, drainTime = 0;
+    PendingRecord *records;
+    InterruptQueue *interruptQueue;
+
+    if( argc > 1 )
+    {
+        interruptCount = atoi( argv[ 1 ] );
+    }
+
+    records = (PendingRecord *)malloc( interruptCount
+                                                * sizeof( PendingRecord ) );
+    interruptQueue = createInterruptQueue( 0, False );
+
+    while( added < interruptCount )
+    {
+        if( nextTestRandom( &randomState ) % 3 == 0
+                                                && interruptQueue->size > 0 )
+        {
+            failures += checkTaken( interruptQueue,
+                        peekInterrupt( interruptQueue ), records, added );
+            interruptQueue = removeInterupt( interruptQueue );
+            taken++;
+        }
+        else
+        {
+            records[ added ].endingTime = windowStart
+                    + nextTestRandom( &randomState ) % TEST_TIME_SPREAD;
+            records[ added ].PID = added;
+            records[ added ].pending = True;
+
+            interruptQueue = addInterrupt( interruptQueue, added,
+                                added % 2 == 0 ? "input" : "output",
+                                added % 2 == 0 ? "keyboard" : "monitor",
+                                                records[ added ].endingTime );
+            added++;
+            windowStart += nextTestRandom( &randomState ) % 3;
+        }
+    }
+
+    while( peekInterrupt( interruptQueue ) != NULL )
+    {
+        batchCount = drainInterrupts( interruptQueue, drainTime );
+
+        for( index = 0; index < batchCount; index++ )
+        {
+            failures += checkTaken( interruptQueue,
+                            &interruptQueue->batch[ index ], records, added );
+            failures += interruptQueue->batch[ index ].endingTime > drainTime;
+        }
+
+        index = findEarliestPending( records, added );
+
+        if( index >= 0 && records[ index ].endingTime <= drainTime )
+        {
+            printf( "FAILED: interrupt %d due at %lld left after drain at "
+                        "%lld\n", index, (long long)records[ index ].endingTime,
+                                                    (long long)drainTime );
+            failures++;
+        }
+
+        taken += batchCount;
+        drainTime += TEST_DRAIN_STEP;
+    }
+
+    if( taken != added || interruptQueue->size != 0 )
+    {
+        printf( "FAILED: %d added, %d taken, %d left\n", added, taken,
+                                                    interruptQueue->size );
+        failures++;
+    }
+
+    printf( "%d interrupts added and taken, %d checks failed\n", added,
+                                                                failures );
+
+    interruptQueue = clearInterruptQueue( interruptQueue );
+    free( records );
+
+    return failures == 0 ? 0 : 1;
+}
+
+/*
+Function name: nextTestRandom
+Algorithm: Advances a xorshift generator
+Precondition: Given generator state
+Postcondition: Returns the next pseudo-random value
+Exceptions: None
+Note: Fixed seeds keep runs repeatable
+*/
+unsigned int nextTestRandom( unsigned int *state )
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/*
+Function name: findEarliestPending
+Algorithm: Scans every record for the pending one with the least ending
+           time, taking the lower PID on a tie
+Precondition: Given records and their count
+Postcondition: Returns index of the earliest pending record, or -1
+Exceptions: None
+Note: O(n)
+*/
+int findEarliestPending( PendingRecord *records, int recordCount )
+{
+    int index, earliest = -1;
+
+    for( index = 0; index < recordCount; index++ )
+    {
+        if( records[ index ].pending == True && ( earliest < 0
+                || records[ index ].endingTime
+                                        < records[ earliest ].endingTime ) )
+        {
+            earliest = index;
+        }
+    }
+
+    return earliest;
+}
+
+/*
+Function name: checkTaken
+Algorithm: Compares an interrupt leaving the queue with the earliest
+           pending record, including its interned op strings, and marks
+           the record taken
+Precondition: Given interrupt queue, interrupt leaving it, records, and
+              their count
+Postcondition: Returns one (1) if the interrupt was not the one expected,
+               zero (0) otherwise
+Exceptions: None
+Note: None
+*/
+int checkTaken( InterruptQueue *interruptQueue, Interrupt *interrupt,
+                                PendingRecord *records, int recordCount )
+{
+    int earliest = findEarliestPending( records, recordCount );
+    char *expectName;
+
+    if( interrupt->PID < 0 || interrupt->PID >= recordCount )
+    {
+        printf( "FAILED: unknown interrupt for PID %d\n", interrupt->PID );
+        return 1;
+    }
+
+    records[ interrupt->PID ].pending = False;
+    expectName = interrupt->PID % 2 == 0 ? "keyboard" : "monitor";
+
+    if( interrupt->PID != earliest || compareString( expectName,
+                getInterruptOpName( interruptQueue, interrupt ) ) != STR_EQ )
+    {
+        printf( "FAILED: took interrupt %d due at %lld, expected %d due "
+                "at %lld\n", interrupt->PID,
+                (long long)interrupt->endingTime, earliest,
+                (long long)records[ earliest ].endingTime );
+        return 1;
+    }
+
+    return 0;
+}
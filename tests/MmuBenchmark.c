@@ -0,0 +1,219 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: MmuBenchmark.c
+Brief: Driver program to check and time the MMU allocation table
+Details: Makes 100k allocation requests spread over many processes and
+         segments, checks every isValidAllocate answer against a brute
+         force overlap scan of the same segment, checks an access to every
+         allocation, and reports the time taken
+Version: 1.0
+         17 October 2026
+         Initial development of MMU benchmark driver program
+Note: Build and run from the repository root with
+          gcc -O2 -I. -o mmuBenchmark tests/MmuBenchmark.c MMU.c StringUtils.c
+          ./mmuBenchmark [request count]
+      Returns zero (0) when every answer matches
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include <time.h>
+#include "MMU.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define BENCH_REQUESTS 100000
+#define BENCH_PROCESSES 100
+#define BENCH_SEGMENTS 100
+#define BENCH_MAX_OFFSET 50
+
+// Data Structure Definitions (structs, enums, etc.)////////////////
+typedef struct BenchRange
+{
+    int base;
+    int offset;
+    struct BenchRange *next;
+} BenchRange;
+
+// Function Prototypes  ///////////////////////////////////////////
+unsigned int nextBenchRandom( unsigned int *state );
+Boolean bruteForceAllocate( BenchRange *ranges, int base, int offset );
+
+/*
+Function name: main
+Algorithm: Draws random allocation requests, compares the MMU answer with
+           the brute force scan, adds the allocations that fit, then
+           accesses each allocation at its last address
+Precondition: Optional request count as command line argument
+Postcondition: Returns zero (0) when every answer matches, one (1) otherwise
+Exceptions: None
+Note: The brute force scan only looks at its own segment, so it stays
+      cheap at 100k requests
+*/
+int main( int argc, char **argv )
+{
+    int requestCount = BENCH_REQUESTS, index, procID, segment, base, offset;
+    int allocations = 0, mismatches = 0, spaceIndex;
+    unsigned int randomState = 12345;
+    int *allocPID, *allocSegment, *allocBase, *allocOffset;
+    BenchRange **spaces, *range, *nextRange;
+    Boolean mmuAnswer;
+    MMU *memory = NULL;
+    clock_t start;
+    double allocSeconds, accessSeconds;
+
+    if( argc > 1 )
+    {
+        requestCount = atoi( argv[ 1 ] );
+    }
+
+    spaces = (BenchRange **)calloc( BENCH_PROCESSES * BENCH_SEGMENTS,
+                                                    sizeof( BenchRange * ) );
+    allocPID = (int *)malloc( requestCount * sizeof( int ) );
+    allocSegment = (int *)malloc( requestCount * sizeof( int ) );
+    allocBase = (int *)malloc( requestCount * sizeof( int ) );
+    allocOffset = (int *)malloc( requestCount * sizeof( int ) );
+
+    // check every answer against the brute force scan
+    for( index = 0; index < requestCount; index++ )
+    {
+        procID = nextBenchRandom( &randomState ) % BENCH_PROCESSES;
+        segment = nextBenchRandom( &randomState ) % BENCH_SEGMENTS;
+        base = nextBenchRandom( &randomState ) % BASE_OFFSET;
+        offset = nextBenchRandom( &randomState ) % BENCH_MAX_OFFSET;
+        spaceIndex = procID * BENCH_SEGMENTS + segment;
+
+        mmuAnswer = isValidAllocate( memory, procID, segment, base, offset );
+
+        if( mmuAnswer != bruteForceAllocate( spaces[ spaceIndex ], base,
+                                                                    offset ) )
+        {
+            mismatches++;
+        }
+
+        if( mmuAnswer == True )
+        {
+            memory = addMem( memory, procID, segment, base, offset );
+
+            range = (BenchRange *)malloc( sizeof( BenchRange ) );
+            range->base = base;
+            range->offset = offset;
+            range->next = spaces[ spaceIndex ];
+            spaces[ spaceIndex ] = range;
+
+            allocPID[ allocations ] = procID;
+            allocSegment[ allocations ] = segment;
+            allocBase[ allocations ] = base;
+            allocOffset[ allocations ] = offset;
+            allocations++;
+        }
+    }
+
+    for( index = 0; index < allocations; index++ )
+    {
+        if( isValidAccess( memory, allocPID[ index ], allocSegment[ index ],
+                    allocBase[ index ], allocOffset[ index ] ) == False
+            || isValidAccess( memory, allocPID[ index ],
+                                allocSegment[ index ], allocBase[ index ],
+                                    allocOffset[ index ] + 1 ) == True )
+        {
+            mismatches++;
+        }
+    }
+
+    memory = clearMMU( memory );
+
+    // time the same requests without the brute force scan
+    randomState = 12345;
+    start = clock();
+
+    for( index = 0; index < requestCount; index++ )
+    {
+        procID = nextBenchRandom( &randomState ) % BENCH_PROCESSES;
+        segment = nextBenchRandom( &randomState ) % BENCH_SEGMENTS;
+        base = nextBenchRandom( &randomState ) % BASE_OFFSET;
+        offset = nextBenchRandom( &randomState ) % BENCH_MAX_OFFSET;
+
+        if( isValidAllocate( memory, procID, segment, base, offset ) == True )
+        {
+            memory = addMem( memory, procID, segment, base, offset );
+        }
+    }
+
+    allocSeconds = (double)( clock() - start ) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for( index = 0; index < allocations; index++ )
+    {
+        isValidAccess( memory, allocPID[ index ], allocSegment[ index ],
+                                    allocBase[ index ], allocOffset[ index ] );
+    }
+
+    accessSeconds = (double)( clock() - start ) / CLOCKS_PER_SEC;
+
+    printf( "%d requests, %d allocations, %d mismatches\n",
+                                    requestCount, allocations, mismatches );
+    printf( "allocate checks: %.3f s, access checks: %.3f s\n",
+                                                allocSeconds, accessSeconds );
+
+    memory = clearMMU( memory );
+
+    for( spaceIndex = 0; spaceIndex < BENCH_PROCESSES * BENCH_SEGMENTS;
+                                                                spaceIndex++ )
+    {
+        for( range = spaces[ spaceIndex ]; range != NULL; range = nextRange )
+        {
+            nextRange = range->next;
+            free( range );
+        }
+    }
+
+    free( spaces );
+    free( allocPID );
+    free( allocSegment );
+    free( allocBase );
+    free( allocOffset );
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+/*
+Function name: nextBenchRandom
+Algorithm: Advances a xorshift generator
+Precondition: Given generator state
+Postcondition: Returns the next pseudo-random value
+Exceptions: None
+Note: Fixed seeds keep runs repeatable
+*/
+unsigned int nextBenchRandom( unsigned int *state )
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+/*
+Function name: bruteForceAllocate
+Algorithm: Scans every allocation of the segment for one that shares an
+           address with the request
+Precondition: Given allocations of one segment, memory base, and offset
+Postcondition: Returns True if no allocation overlaps the request
+Exceptions: None
+Note: None
+*/
+Boolean bruteForceAllocate( BenchRange *ranges, int base, int offset )
+{
+    while( ranges != NULL )
+    {
+        if( base <= ranges->base + ranges->offset
+                                            && ranges->base <= base + offset )
+        {
+            return False;
+        }
+
+        ranges = ranges->next;
+    }
+
+    return True;
+}
@@ -0,0 +1,198 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: MultiCoreTailTest.c
+Brief: Driver program to check memory operations after the last run
+       operation of a process
+Details: Runs a process whose memory operations follow its last run
+         operation under FCFS-N and SJF-N on one core and on four cores,
+         and checks every run logs the same MMU requests
+Version: 1.0
+         17 October 2026
+         Initial development of multi-core tail test driver program
+Note: Build and run from the repository root with
+          gcc -I. -o multiCoreTailTest tests/MultiCoreTailTest.c
+                CfsScheduler.c ConfigAccess.c DeviceManager.c
+                EdfScheduler.c InterruptHandling.c MMU.c MetaDataAccess.c
+                MlfqScheduler.c MultiCore.c OutputHandling.c Paging.c
+                PcbHeap.c PcbRing.c PcbTree.c Scheduler.c SimClock.c
+                Simulator.c StrideScheduler.c StringUtils.c simtimer.c
+                                                                -lpthread
+          ./multiCoreTailTest
+      Writes its config, metadata, and log files to the current directory;
+      returns zero (0) when every check passes
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include "ConfigAccess.h"
+#include "MetaDataAccess.h"
+#include "Simulator.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define TEST_CONFIG_FILE "multiCoreTailTest.cnf"
+#define TEST_METADATA_FILE "multiCoreTailTest.mdf"
+#define TEST_LOG_FILE "multiCoreTailTest.lgf"
+#define TEST_MMU_LINES 4
+
+// Function Prototypes  ///////////////////////////////////////////
+int runTailCase( const char *policyName, int cpuCores );
+int countLogLines( const char *searchText );
+int checkCondition( Boolean condition, const char *policyName,
+                                    int cpuCores, const char *description );
+
+/*
+Function name: main
+Algorithm: Writes the metadata file, then runs it under each
+           non-preemptive policy on one core and on four cores
+Precondition: None
+Postcondition: Returns zero (0) when every check passes, one (1) otherwise
+Exceptions: None
+Note: None
+*/
+int main( void )
+{
+    FILE *filePtr = fopen( TEST_METADATA_FILE, "w" );
+    int failures = 0;
+
+    if( filePtr == NULL )
+    {
+        printf( "FAILED: cannot write %s\n", TEST_METADATA_FILE );
+        return 1;
+    }
+
+    fprintf( filePtr, "Start Program Meta-Data Code:\n"
+                      "S(start)0;\n"
+                      " A(start)0; P(run)3; M(allocate)1010100;"
+                                    " M(access)1010050; A(end)0;\n"
+                      " S(end)0;\n"
+                      "End Program Meta-Data Code.\n" );
+    fclose( filePtr );
+
+    failures += runTailCase( "FCFS-N", 1 );
+    failures += runTailCase( "FCFS-N", 4 );
+    failures += runTailCase( "SJF-N", 1 );
+    failures += runTailCase( "SJF-N", 4 );
+
+    printf( "%d checks failed\n", failures );
+
+    return failures == 0 ? 0 : 1;
+}
+
+/*
+Function name: runTailCase
+Algorithm: Writes a config for the policy and core count with the real
+           clock and a log file, runs the simulator, and counts the MMU
+           lines of the log
+Precondition: Given policy name and number of cores; metadata file
+              written
+Postcondition: Returns the number of failed checks
+Exceptions: None
+Note: Several cores only run in parallel under the real clock
+*/
+int runTailCase( const char *policyName, int cpuCores )
+{
+    FILE *filePtr = fopen( TEST_CONFIG_FILE, "w" );
+    ConfigDataType *configDataPtr = NULL;
+    OpCodeType *mdData = NULL;
+    int failures = 0, runResult = -1;
+
+    if( filePtr == NULL )
+    {
+        return checkCondition( False, policyName, cpuCores,
+                                                    "config file written" );
+    }
+
+    fprintf( filePtr, "Start Simulator Configuration File:\n"
+                      "Version/Phase: 4.0\n"
+                      "File Path: %s\n"
+                      "CPU Scheduling Code: %s\n"
+                      "Quantum Time (cycles): 3\n"
+                      "Memory Available (KB): 2048\n"
+                      "Processor Cycle Time (msec): 1\n"
+                      "I/O Cycle Time (msec): 1\n"
+                      "Log To: File\n"
+                      "Log File Path: %s\n"
+                      "CPU Cores: %d\n"
+                      "End Simulator Configuration File.\n",
+                      TEST_METADATA_FILE, policyName, TEST_LOG_FILE,
+                                                                cpuCores );
+    fclose( filePtr );
+
+    remove( TEST_LOG_FILE );
+
+    if( getConfigData( TEST_CONFIG_FILE, &configDataPtr ) == NO_ERR
+                    && getOpCodes( TEST_METADATA_FILE, &mdData ) == NO_ERR )
+    {
+        runResult = runSimulator( configDataPtr, mdData );
+    }
+
+    failures += checkCondition( runResult == NO_ERR, policyName, cpuCores,
+                                                    "simulator runs" );
+    failures += checkCondition( countLogLines( "MMU" ) == TEST_MMU_LINES,
+                policyName, cpuCores, "allocate and access are both logged" );
+    failures += checkCondition( countLogLines( "MMU successful" ) == 2,
+                policyName, cpuCores, "allocate and access both succeed" );
+
+    clearConfigData( &configDataPtr );
+    mdData = clearMetaDataList( mdData );
+
+    return failures;
+}
+
+/*
+Function name: countLogLines
+Algorithm: Reads the log file line by line, counting the lines holding
+           the text
+Precondition: Given search text
+Postcondition: Returns the number of matching lines, or -1 if the log
+               cannot be read
+Exceptions: None
+Note: None
+*/
+int countLogLines( const char *searchText )
+{
+    FILE *filePtr = fopen( TEST_LOG_FILE, "r" );
+    char lineStr[ MAX_STR_LEN ];
+    int lineCount = 0;
+
+    if( filePtr == NULL )
+    {
+        return -1;
+    }
+
+    while( fgets( lineStr, MAX_STR_LEN, filePtr ) != NULL )
+    {
+        if( findSubString( lineStr, (char *)searchText )
+                                                    != SUBSTRING_NOT_FOUND )
+        {
+            lineCount++;
+        }
+    }
+
+    fclose( filePtr );
+
+    return lineCount;
+}
+
+/*
+Function name: checkCondition
+Algorithm: Prints the policy, core count, and description of a failed
+           check
+Precondition: Given check result, policy name, core count, and check
+              description
+Postcondition: Returns one (1) if the check failed, zero (0) otherwise
+Exceptions: None
+Note: None
+*/
+int checkCondition( Boolean condition, const char *policyName,
+                                    int cpuCores, const char *description )
+{
+    if( condition == False )
+    {
+        printf( "FAILED: %s on %d cores, %s\n", policyName, cpuCores,
+                                                                description );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: PageReplacementTest.c
+Brief: Driver program to check demand paging page replacement
+Details: Runs the reference string 7 0 1 2 0 3 0 4 2 3 0 3 2 1 2 0 1 7 0 1
+         through three frames under FIFO, LRU, and Clock, checking every
+         fault, the page each fault evicts, and the fault and page out
+         counts, the Clock second chance sweep, and that releasePages
+         returns every frame of a process
+Version: 1.0
+         17 October 2026
+         Initial development of page replacement test driver program
+Note: Build and run from the repository root with
+          gcc -I. -o pageReplacementTest tests/PageReplacementTest.c
+                Paging.c MMU.c StringUtils.c ConfigAccess.c SimClock.c
+                                                            simtimer.c
+          ./pageReplacementTest
+      Returns zero (0) when every check passes
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include "Paging.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define TEST_FRAMES 3
+#define TEST_PAGES 8
+#define TEST_REFERENCES 20
+
+// Function Prototypes  ///////////////////////////////////////////
+int runReferenceString( int replacementCode, const char *policyName,
+                        int expectFaults, const int *expectVictims,
+                                                        int victimCount );
+int checkCondition( Boolean condition, const char *policyName,
+                                                const char *description );
+
+/*
+Function name: main
+Algorithm: Runs the reference string under each replacement policy with
+           the faults and victims worked out by hand
+Precondition: None
+Postcondition: Returns zero (0) when every check passes, one (1) otherwise
+Exceptions: None
+Note: FIFO and LRU give the textbook 15 and 12 faults; Clock gives 14
+*/
+int main( void )
+{
+    const int fifoVictims[] = { 7, 0, 1, 2, 3, 0, 4, 2, 3, 0, 1, 2 };
+    const int lruVictims[] = { 7, 1, 2, 3, 0, 4, 0, 3, 2 };
+    const int clockVictims[] = { 1, 7, 2, 0, 3, 4, 2, 0, 3, 1, 2 };
+    int failures = 0;
+
+    failures += runReferenceString( REPLACE_FIFO_CODE, "FIFO", 15,
+                                                            fifoVictims, 12 );
+    failures += runReferenceString( REPLACE_LRU_CODE, "LRU", 12,
+                                                            lruVictims, 9 );
+    failures += runReferenceString( REPLACE_CLOCK_CODE, "Clock", 14,
+                                                            clockVictims, 11 );
+
+    printf( "%d checks failed\n", failures );
+
+    return failures == 0 ? 0 : 1;
+}
+
+/*
+Function name: runReferenceString
+Algorithm: Fills the three frames with pages of process 1, maps the eight
+           pages of process 0 so they all start on the swap device, then
+           releases process 1 so its frames come free; accesses the pages
+           of process 0 in reference string order, loading each page that
+           faults, and checks every result; finally releases process 0
+Precondition: Given replacement code, its name, and the expected faults
+              and victim pages
+Postcondition: Returns the number of failed checks
+Exceptions: None
+Note: Process 1 hands its frames back in the order 2, 1, 0, which places
+      the first three pages of process 0 there; the Clock hand starts at
+      frame 0
+*/
+int runReferenceString( int replacementCode, const char *policyName,
+                        int expectFaults, const int *expectVictims,
+                                                        int victimCount )
+{
+    const int references[ TEST_REFERENCES ] = { 7, 0, 1, 2, 0, 3, 0, 4, 2,
+                                        3, 0, 3, 2, 1, 2, 0, 1, 7, 0, 1 };
+    ConfigDataType config = { 0 };
+    PagingType *paging;
+    PageEntry *page;
+    int failures = 0, faults = 0, victims = 0, index, frame;
+    int victimPID, victimVpn;
+    Boolean resident = False;
+    char description[ STD_STR_LEN ];
+
+    config.memAvailable = TEST_FRAMES;
+    config.pagingCode = PAGING_DEMAND_CODE;
+    config.pageReplacementCode = replacementCode;
+    config.pageSize = 1;
+    config.tlbEntries = 2;
+    config.swapTime = 20;
+
+    paging = createPaging( &config, 2 );
+
+    failures += checkCondition( mapPages( paging, 1, 0, 0, TEST_FRAMES - 1 )
+                                            && paging->freeCount == 0,
+                    policyName, "process 1 takes every frame" );
+    failures += checkCondition( mapPages( paging, 0, 0, 0, TEST_PAGES - 1 ),
+                    policyName, "process 0 maps its pages onto swap" );
+
+    for( index = 0; index < TEST_PAGES; index++ )
+    {
+        page = findPageEntry( &paging->tables[ 0 ], index );
+        resident = resident || page == NULL || page->frame != NO_FRAME;
+    }
+
+    failures += checkCondition( resident == False, policyName,
+                                    "no page of process 0 is resident" );
+
+    releasePages( paging, 1 );
+    failures += checkCondition( paging->freeCount == TEST_FRAMES,
+                    policyName, "releasing process 1 frees its frames" );
+
+    for( index = 0; index < TEST_REFERENCES; index++ )
+    {
+        if( translateAddress( paging, 0, 0, references[ index ], 0, &frame )
+                                            == False && frame == NO_FRAME )
+        {
+            frame = loadPage( paging, 0, 0, references[ index ], &victimPID,
+                                                                &victimVpn );
+            faults++;
+
+            if( victimPID != NO_PROCESS )
+            {
+                sprintf( description, "reference %d to page %d evicts "
+                            "page %d", index, references[ index ],
+                    victims < victimCount ? expectVictims[ victims ] : -1 );
+                failures += checkCondition( victimPID == 0
+                                    && victims < victimCount
+                                    && victimVpn == expectVictims[ victims ],
+                                                policyName, description );
+                victims++;
+            }
+        }
+
+        page = findPageEntry( &paging->tables[ 0 ], references[ index ] );
+        sprintf( description, "page %d is resident after reference %d",
+                                                references[ index ], index );
+        failures += checkCondition( frame != NO_FRAME && page != NULL
+                            && page->frame == frame, policyName, description );
+
+        // the first eviction sweeps past all three referenced frames
+        if( replacementCode == REPLACE_CLOCK_CODE && index == 3 )
+        {
+            failures += checkCondition( paging->clockHand == 1
+                            && paging->frames[ 0 ].referenced == True
+                            && paging->frames[ 1 ].referenced == False
+                            && paging->frames[ 2 ].referenced == False,
+                policyName, "second chance clears every referenced bit" );
+        }
+    }
+
+    sprintf( description, "%d faults and %d pages out", expectFaults,
+                                                                victimCount );
+    failures += checkCondition( faults == expectFaults
+                        && paging->pageFaults[ 0 ] == expectFaults
+                        && victims == victimCount
+                        && paging->pagesOut == victimCount,
+                                                policyName, description );
+
+    releasePages( paging, 0 );
+    failures += checkCondition( paging->freeCount == TEST_FRAMES
+                        && paging->newestFrame == NO_FRAME
+                        && paging->oldestFrame == NO_FRAME
+                        && findTlbEntry( &paging->tlb, 0, 0 ) == NULL
+                        && findTlbEntry( &paging->tlb, 0, 1 ) == NULL,
+                policyName, "releasing process 0 frees every frame" );
+
+    printf( "%s: %ld faults, %ld pages out\n", policyName,
+                                paging->pageFaults[ 0 ], paging->pagesOut );
+
+    paging = clearPaging( paging );
+
+    return failures;
+}
+
+/*
+Function name: checkCondition
+Algorithm: Prints the policy and description of a failed check
+Precondition: Given check result, policy name, and check description
+Postcondition: Returns one (1) if the check failed, zero (0) otherwise
+Exceptions: None
+Note: None
+*/
+int checkCondition( Boolean condition, const char *policyName,
+                                                const char *description )
+{
+    if( condition == False )
+    {
+        printf( "FAILED: %s, %s\n", policyName, description );
+        return 1;
+    }
+
+    return 0;
+}
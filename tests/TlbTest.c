@@ -0,0 +1,159 @@
+// Program Information ////////////////////////////////////////////
+/*
+File: TlbTest.c
+Brief: Driver program to check the LRU translation lookaside buffer
+Details: Maps ten pages for one process, then runs a known sequence of
+         accesses through a four entry TLB and checks each hit or miss,
+         the page evicted by each miss, the final recency order, the hit
+         and miss counts, and that the TLB tells processes apart
+Version: 1.0
+         17 October 2026
+         Initial development of TLB test driver program
+Note: Build and run from the repository root with
+          gcc -I. -o tlbTest tests/TlbTest.c Paging.c MMU.c StringUtils.c
+                                    ConfigAccess.c SimClock.c simtimer.c
+          ./tlbTest
+      Returns zero (0) when every check passes
+*/
+
+// Header Files ///////////////////////////////////////////////////
+#include <stdio.h>
+#include "Paging.h"
+
+// Global Constant Definitions ////////////////////////////////////
+#define TEST_TLB_ENTRIES 4
+#define TEST_PAGES 10
+#define TEST_ACCESSES 12
+
+// Function Prototypes  ///////////////////////////////////////////
+int checkCondition( Boolean condition, const char *description );
+
+/*
+Function name: main
+Algorithm: Accesses pages 0 1 2 3 0 4 1 2 0 5 0 3 of process 0 with one
+           page per KB, comparing every result with the outcome worked out
+           by hand for an LRU TLB of four entries, then accesses page 0 of
+           process 1
+Precondition: None
+Postcondition: Returns zero (0) when every check passes, one (1) otherwise
+Exceptions: None
+Note: The page evicted by a miss is the one that was least recent before
+      the access
+*/
+int main( void )
+{
+    const int accessPages[ TEST_ACCESSES ] =
+                                    { 0, 1, 2, 3, 0, 4, 1, 2, 0, 5, 0, 3 };
+    const Boolean expectHit[ TEST_ACCESSES ] =
+                                    { False, False, False, False, True,
+                                      False, False, False, True,
+                                      False, True, False };
+    const int expectEvicted[ TEST_ACCESSES ] =
+                                    { -1, -1, -1, -1, -1, 1, 2, 3, -1, 4,
+                                      -1, 1 };
+    const int expectOrder[ TEST_TLB_ENTRIES ] = { 3, 0, 5, 2 };
+    ConfigDataType config = { 0 };
+    PagingType *paging;
+    TlbEntry *entry, *victim;
+    PageEntry *page;
+    Boolean hit;
+    int failures = 0, index, frame, victimVpn;
+    char description[ STD_STR_LEN ];
+
+    config.memAvailable = 64;
+    config.pagingCode = PAGING_ON_CODE;
+    config.pageSize = 1;
+    config.tlbEntries = TEST_TLB_ENTRIES;
+    config.tlbMissCost = 1;
+    config.pageWalkCost = 2;
+
+    paging = createPaging( &config, 2 );
+
+    failures += checkCondition( mapPages( paging, 0, 0, 0, TEST_PAGES - 1 ),
+                                            "process 0 maps its ten pages" );
+
+    for( index = 0; index < TEST_ACCESSES; index++ )
+    {
+        victim = paging->tlb.leastRecent;
+        victimVpn = victim->valid == True ? victim->vpn : -1;
+
+        hit = translateAddress( paging, 0, 0, accessPages[ index ], 0,
+                                                                    &frame );
+        page = findPageEntry( &paging->tables[ 0 ], accessPages[ index ] );
+
+        sprintf( description, "access %d to page %d is a %s", index,
+                    accessPages[ index ],
+                    expectHit[ index ] == True ? "hit" : "miss" );
+        failures += checkCondition( hit == expectHit[ index ], description );
+
+        sprintf( description, "access %d returns the frame of page %d",
+                                                index, accessPages[ index ] );
+        failures += checkCondition( page != NULL && frame == page->frame,
+                                                                description );
+
+        if( expectEvicted[ index ] >= 0 )
+        {
+            sprintf( description, "access %d evicts page %d", index,
+                                                    expectEvicted[ index ] );
+            failures += checkCondition( victimVpn == expectEvicted[ index ]
+                        && findTlbEntry( &paging->tlb, 0, victimVpn ) == NULL,
+                                                                description );
+        }
+    }
+
+    entry = paging->tlb.mostRecent;
+
+    for( index = 0; index < TEST_TLB_ENTRIES; index++ )
+    {
+        sprintf( description, "recency position %d holds page %d", index,
+                                                        expectOrder[ index ] );
+        failures += checkCondition( entry != NULL && entry->valid == True
+                        && entry->vpn == expectOrder[ index ], description );
+        entry = entry != NULL ? entry->lruNext : NULL;
+    }
+
+    failures += checkCondition( paging->tlbHits[ 0 ] == 3
+                                            && paging->tlbMisses[ 0 ] == 9,
+                                    "process 0 has 3 hits and 9 misses" );
+    printf( "process 0 hit rate: %.1f%%\n", 100.0 * paging->tlbHits[ 0 ]
+                        / ( paging->tlbHits[ 0 ] + paging->tlbMisses[ 0 ] ) );
+
+    // same page number, other process: a miss that evicts page 2
+    failures += checkCondition( mapPages( paging, 1, 0, 0, 0 ),
+                                                "process 1 maps page 0" );
+    hit = translateAddress( paging, 1, 0, 0, 0, &frame );
+    failures += checkCondition( hit == False,
+                                    "page 0 of process 1 misses the TLB" );
+    failures += checkCondition( findTlbEntry( &paging->tlb, 0, 2 ) == NULL
+                            && findTlbEntry( &paging->tlb, 1, 0 ) != NULL
+                            && findTlbEntry( &paging->tlb, 0, 0 ) != NULL,
+                "page 2 of process 0 is evicted, page 0 of both is cached" );
+    failures += checkCondition( paging->tlbHits[ 1 ] == 0
+                                            && paging->tlbMisses[ 1 ] == 1,
+                                    "process 1 has 0 hits and 1 miss" );
+
+    paging = clearPaging( paging );
+
+    printf( "%d checks failed\n", failures );
+
+    return failures == 0 ? 0 : 1;
+}
+
+/*
+Function name: checkCondition
+Algorithm: Prints the description of a failed check
+Precondition: Given check result and its description
+Postcondition: Returns one (1) if the check failed, zero (0) otherwise
+Exceptions: None
+Note: None
+*/
+int checkCondition( Boolean condition, const char *description )
+{
+    if( condition == False )
+    {
+        printf( "FAILED: %s\n", description );
+        return 1;
+    }
+
+    return 0;
+}